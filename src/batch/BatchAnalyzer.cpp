@@ -0,0 +1,224 @@
+#include "BatchAnalyzer.h"
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+BatchAnalyzer::BatchAnalyzer(const Options& options, AnalysisCallback on_result)
+    : on_result(std::move(on_result)), default_limits(options.default_limits) {
+    int count = options.workers > 0 ? options.workers : static_cast<int>(std::thread::hardware_concurrency());
+    count = std::max(1, count);
+    if (has_no_limit(default_limits)) {
+        default_limits.depth = DEFAULT_DEPTH;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+        workers.back()->engine.get_search().set_hash_size(options.hash_mb);
+    }
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i]->thread = std::thread(&BatchAnalyzer::work, this, i);
+    }
+}
+
+BatchAnalyzer::~BatchAnalyzer() {
+    size_t dropped = 0;
+    for (auto& worker : workers) {
+        std::lock_guard<std::mutex> lock(worker->tasks_mutex);
+        dropped += worker->tasks.size();
+        queued -= worker->tasks.size();
+        worker->tasks.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        shutting_down = true;
+    }
+    finish_tasks(dropped);
+    work_available.notify_all();
+    for (auto& worker : workers) {
+        worker->thread.join();
+    }
+}
+
+size_t BatchAnalyzer::submit(const std::string& fen, const Search::SearchLimits& limits) {
+    Task task;
+    task.fen = fen;
+    task.limits = has_no_limit(limits) ? default_limits : limits;
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        task.index = submitted++;
+    }
+
+    // Deal round-robin; stealing evens out what the deal gets wrong
+    size_t index = task.index;
+    Worker& owner = *workers[index % workers.size()];
+    {
+        std::lock_guard<std::mutex> lock(owner.tasks_mutex);
+        owner.tasks.push_back(std::move(task));
+        queued++;
+    }
+    {
+        // Taking the lock orders this wake-up after a worker's check of queued
+        std::lock_guard<std::mutex> lock(state_mutex);
+    }
+    work_available.notify_one();
+    return index;
+}
+
+bool BatchAnalyzer::submit_line(const std::string& line) {
+    size_t start = line.find_first_not_of(" \t\r");
+    if (start == std::string::npos || line[start] == '#') {
+        return false;
+    }
+
+    size_t separator = line.find(';');
+    std::string fen = line.substr(start, separator == std::string::npos ? std::string::npos : separator - start);
+    fen.erase(fen.find_last_not_of(" \t\r") + 1);
+
+    Search::SearchLimits limits;
+    if (separator != std::string::npos) {
+        std::istringstream tokens(line.substr(separator + 1));
+        std::string name;
+        int value = 0;
+        while (tokens >> name >> value) {
+            if (value < 0) {
+                continue;
+            }
+            if (name == "depth") {
+                limits.depth = value;
+            } else if (name == "movetime") {
+                limits.move_time = std::chrono::milliseconds(value);
+            } else if (name == "nodes") {
+                limits.nodes = value;
+            }
+        }
+    }
+    submit(fen, limits);
+    return true;
+}
+
+void BatchAnalyzer::run(std::istream& input) {
+    std::string line;
+    while (std::getline(input, line)) {
+        submit_line(line);
+    }
+    wait();
+}
+
+void BatchAnalyzer::wait() {
+    std::unique_lock<std::mutex> lock(state_mutex);
+    all_done.wait(lock, [this] { return finished == submitted; });
+}
+
+std::vector<BatchAnalyzer::Analysis> BatchAnalyzer::analyze(const std::vector<std::string>& fens,
+                                                            const Options& options) {
+    std::vector<Analysis> analyses(fens.size());
+    BatchAnalyzer analyzer(options, [&analyses](const Analysis& analysis) {
+        analyses[analysis.index] = analysis;
+    });
+    for (const std::string& fen : fens) {
+        analyzer.submit(fen);
+    }
+    analyzer.wait();
+    return analyses;
+}
+
+std::string BatchAnalyzer::format(const Analysis& analysis) {
+    std::string line = std::to_string(analysis.index);
+    if (!analysis.valid) {
+        return line + " error invalid fen";
+    }
+
+    const Search::SearchResult& result = analysis.result;
+    line += " bestmove " + (result.best_move.is_null() ? std::string("0000") : result.best_move.to_algebraic());
+    if (result.pv.size() > 1) {
+        line += " ponder " + result.pv[1].to_algebraic();
+    }
+    line += result.is_mate ? " score mate " + std::to_string(result.mate_in)
+                           : " score cp " + std::to_string(result.score);
+    line += " depth " + std::to_string(result.depth) +
+            " nodes " + std::to_string(result.stats.nodes_searched) +
+            " time " + std::to_string(result.stats.time_elapsed.count());
+    if (!result.pv.empty()) {
+        line += " pv";
+        for (size_t i = 0; i < result.pv.size(); ++i) {
+            line += " " + result.pv[i].to_algebraic();
+        }
+    }
+    return line;
+}
+
+void BatchAnalyzer::work(size_t self) {
+    Worker& worker = *workers[self];
+    while (true) {
+        Task task;
+        if (!take_task(self, task)) {
+            std::unique_lock<std::mutex> lock(state_mutex);
+            work_available.wait(lock, [this] { return shutting_down || queued > 0; });
+            if (shutting_down) {
+                return;
+            }
+            continue;
+        }
+
+        Analysis analysis = analyze_task(worker, task);
+        if (on_result) {
+            std::lock_guard<std::mutex> lock(result_mutex);
+            on_result(analysis);
+        }
+        finish_tasks(1);
+    }
+}
+
+bool BatchAnalyzer::take_task(size_t self, Task& task) {
+    {
+        Worker& own = *workers[self];
+        std::lock_guard<std::mutex> lock(own.tasks_mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            queued--;
+            return true;
+        }
+    }
+
+    // Steal the most recently queued task of the first worker that has one
+    for (size_t offset = 1; offset < workers.size(); ++offset) {
+        Worker& victim = *workers[(self + offset) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.tasks_mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+BatchAnalyzer::Analysis BatchAnalyzer::analyze_task(Worker& worker, const Task& task) {
+    Analysis analysis;
+    analysis.index = task.index;
+    analysis.fen = task.fen;
+    analysis.valid = Board::is_valid_fen(task.fen);
+    if (analysis.valid) {
+        worker.engine.set_position(task.fen);
+        analysis.result = worker.engine.get_best_move(task.limits);
+    }
+    return analysis;
+}
+
+void BatchAnalyzer::finish_tasks(size_t count) {
+    if (count == 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        finished += count;
+    }
+    all_done.notify_all();
+}
+
+bool BatchAnalyzer::has_no_limit(const Search::SearchLimits& limits) {
+    return limits.depth == 0 && limits.move_time.count() == 0 && limits.nodes == 0 &&
+           limits.time_control.time_left.count() == 0;
+}
@@ -0,0 +1,205 @@
+#ifndef BATCH_ANALYZER_H
+#define BATCH_ANALYZER_H
+
+#include "../engine/Engine.h"
+#include "../engine/Search.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Searches many independent positions concurrently
+ *
+ * Every worker thread owns a whole engine (board, evaluation with pawn hash,
+ * search with transposition table and history) and searches one position at
+ * a time single-threaded, so positions never contend for anything but the
+ * task queues and throughput grows with the number of cores.
+ *
+ * Submitted positions are dealt round-robin onto per-worker queues. A worker
+ * takes from the front of its own queue and, once that is empty, steals from
+ * the back of another worker's queue, so uneven search times do not leave
+ * cores idle. Each result is passed to the callback as soon as its search
+ * finishes (completion order, not input order), tagged with the index the
+ * position was given by submit().
+ */
+class BatchAnalyzer {
+public:
+    static constexpr int DEFAULT_DEPTH = 8;   ///< Depth searched when neither the position nor the defaults set a limit
+
+    /**
+     * @brief Resources of the worker pool
+     */
+    struct Options {
+        int workers = 0;                                          ///< Worker threads (0 = one per hardware thread)
+        size_t hash_mb = TranspositionTable::DEFAULT_SIZE_MB;     ///< Transposition table size of each worker
+        Search::SearchLimits default_limits;                      ///< Limits of positions submitted without any
+    };
+
+    /**
+     * @brief Outcome of one position
+     */
+    struct Analysis {
+        size_t index = 0;              ///< Order in which the position was submitted, from 0
+        std::string fen;               ///< The position
+        bool valid = true;             ///< false if the FEN was rejected (result is then empty)
+        Search::SearchResult result;   ///< Search result of a valid position
+    };
+
+    using AnalysisCallback = std::function<void(const Analysis&)>;
+
+    /**
+     * @brief Start the worker pool
+     *
+     * @param options Pool size, per-worker resources and default limits
+     * @param on_result Called once per position from a worker thread; calls
+     *                  are serialised, so it needs no locking of its own
+     */
+    BatchAnalyzer(const Options& options, AnalysisCallback on_result);
+
+    /**
+     * @brief Destructor - drops positions not yet started, lets running ones finish and joins the workers
+     */
+    ~BatchAnalyzer();
+
+    BatchAnalyzer(const BatchAnalyzer&) = delete;
+    BatchAnalyzer& operator=(const BatchAnalyzer&) = delete;
+
+    /**
+     * @brief Queue a position
+     *
+     * @param fen Position to search
+     * @param limits Limits of this position; if none is set, the default limits apply
+     * @return Index the result will carry
+     */
+    size_t submit(const std::string& fen, const Search::SearchLimits& limits = Search::SearchLimits());
+
+    /**
+     * @brief Queue a position given as one line of a batch file
+     *
+     * The line is a FEN, optionally followed by ";" and limits in the style
+     * of the UCI go command: "<fen> ; depth 12 movetime 500 nodes 100000".
+     * Blank lines and lines starting with "#" are skipped.
+     *
+     * @param line The input line
+     * @return true if a position was queued
+     */
+    bool submit_line(const std::string& line);
+
+    /**
+     * @brief Queue every line of a stream as it is read
+     *
+     * Searching starts with the first line, so the input may be a pipe that
+     * is still being written. Returns once every position has been analysed.
+     *
+     * @param input Stream of batch lines
+     */
+    void run(std::istream& input);
+
+    /**
+     * @brief Block until every submitted position has been analysed
+     */
+    void wait();
+
+    /**
+     * @brief Get the number of worker threads
+     */
+    int worker_count() const { return static_cast<int>(workers.size()); }
+
+    /**
+     * @brief Analyse a list of positions and return the results in input order
+     *
+     * @param fens Positions to search
+     * @param options Pool size, per-worker resources and the limits of every position
+     * @return One analysis per position, analyses[i].index == i
+     */
+    static std::vector<Analysis> analyze(const std::vector<std::string>& fens, const Options& options);
+
+    /**
+     * @brief Format an analysis as one output line
+     *
+     * "<index> bestmove <move> [ponder <move>] score cp <n>|mate <n> depth <d>
+     * nodes <n> time <ms> pv <moves>", or "<index> error invalid fen".
+     *
+     * @param analysis The analysis
+     */
+    static std::string format(const Analysis& analysis);
+
+private:
+    /**
+     * @brief A position waiting in a queue
+     */
+    struct Task {
+        size_t index = 0;
+        std::string fen;
+        Search::SearchLimits limits;
+    };
+
+    /**
+     * @brief One pool thread with its engine and task queue
+     */
+    struct Worker {
+        Engine engine;
+        std::thread thread;
+        std::deque<Task> tasks;        ///< Own queue: the owner pops the front, thieves the back
+        std::mutex tasks_mutex;        ///< Guards tasks
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    AnalysisCallback on_result;
+    Search::SearchLimits default_limits;
+    std::mutex result_mutex;                     ///< Serialises on_result calls
+
+    std::atomic<size_t> queued{0};               ///< Tasks in all queues (changed with the queue's lock held)
+    std::mutex state_mutex;                      ///< Guards submitted, finished, shutting_down and the wake-ups
+    std::condition_variable work_available;
+    std::condition_variable all_done;
+    size_t submitted = 0;                        ///< Positions accepted so far (also the next index)
+    size_t finished = 0;                         ///< Positions analysed or dropped
+    bool shutting_down = false;
+
+    /**
+     * @brief Body of a worker thread: analyse positions until shutdown
+     *
+     * @param self Index of the worker this thread belongs to
+     */
+    void work(size_t self);
+
+    /**
+     * @brief Take the next task, from the worker's own queue or by stealing
+     *
+     * @param self Index of the worker looking for work
+     * @param task Receives the task
+     * @return false if every queue is empty
+     */
+    bool take_task(size_t self, Task& task);
+
+    /**
+     * @brief Search one position on a worker's engine
+     *
+     * @param worker Worker running the task
+     * @param task The position and its limits
+     * @return The analysis
+     */
+    Analysis analyze_task(Worker& worker, const Task& task);
+
+    /**
+     * @brief Count positions as done and wake wait()
+     *
+     * @param count Number of positions analysed or dropped
+     */
+    void finish_tasks(size_t count);
+
+    /**
+     * @brief Check whether no limit at all is set
+     */
+    static bool has_no_limit(const Search::SearchLimits& limits);
+};
+
+#endif // BATCH_ANALYZER_H
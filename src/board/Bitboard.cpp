@@ -20,7 +20,9 @@ std::array<Bitboard, 64> BitboardUtils::knight_attacks_table;
 std::array<Bitboard, 64> BitboardUtils::king_attacks_table;
 std::array<Bitboard, 64> BitboardUtils::white_pawn_attacks_table;
 std::array<Bitboard, 64> BitboardUtils::black_pawn_attacks_table;
-bool BitboardUtils::is_initialized = false;
+std::array<std::array<Bitboard, 64>, 64> BitboardUtils::between_table;
+std::array<std::array<Bitboard, 64>, 64> BitboardUtils::line_table;
+std::once_flag BitboardUtils::init_flag;
 
 // Magic numbers for rook attacks (pre-computed)
 static constexpr std::array<Bitboard, 64> ROOK_MAGICS = {
@@ -45,7 +47,7 @@ static constexpr std::array<Bitboard, 64> ROOK_MAGICS = {
 // Magic numbers for bishop attacks (from Stockfish)
 static constexpr std::array<Bitboard, 64> BISHOP_MAGICS = {
     0x89a1121896040240ULL, 0x2004844802002010ULL, 0x2068080051921000ULL, 0x62880a0220200808ULL,
-    0x4042004402810011ULL, 0x100822020200011ULL, 0xc00444222012000aULL, 0x28808801216001ULL,
+    0x0902021006098030ULL, 0x100822020200011ULL, 0xc00444222012000aULL, 0x28808801216001ULL,
     0x400492088408100ULL, 0x201c401040c0084ULL, 0x840800910a0010ULL, 0x82080240060ULL,
     0x2000840504006000ULL, 0x30010c4108405004ULL, 0x1008005410080802ULL, 0x8144042209100900ULL,
     0x208081020014400ULL, 0x4800201208ca00ULL, 0xf18140408012008ULL, 0x1004002802102001ULL,
@@ -90,8 +92,10 @@ static Bitboard rook_table[102400];
 static Bitboard bishop_table[5248];
 
 void BitboardUtils::init() {
-    if (is_initialized) return;
-    
+    std::call_once(init_flag, fill_tables);
+}
+
+void BitboardUtils::fill_tables() {
     // Copy pre-computed magic numbers
     rook_magics = ROOK_MAGICS;
     bishop_magics = BISHOP_MAGICS;
@@ -103,8 +107,7 @@ void BitboardUtils::init() {
     init_knight_attacks();
     init_king_attacks();
     init_pawn_attacks();
-    
-    is_initialized = true;
+    init_line_tables();
 }
 
 void BitboardUtils::init_rook_attacks() {
@@ -291,6 +294,34 @@ Bitboard BitboardUtils::bishop_mask(int square) {
     return mask;
 }
 
+void BitboardUtils::init_line_tables() {
+    for (int sq1 = 0; sq1 < 64; sq1++) {
+        Bitboard sq1_bb = 1ULL << sq1;
+        
+        for (int sq2 = 0; sq2 < 64; sq2++) {
+            Bitboard sq2_bb = 1ULL << sq2;
+            between_table[sq1][sq2] = 0;
+            line_table[sq1][sq2] = 0;
+            if (sq1 == sq2) continue;
+            
+            // On an empty board the two squares see each other along exactly one
+            // ray family; the rays from both ends intersect in the shared line.
+            // With the far endpoint as the only blocker they intersect in the gap.
+            if (generate_rook_attacks_slow(sq1, 0) & sq2_bb) {
+                line_table[sq1][sq2] = (generate_rook_attacks_slow(sq1, 0) &
+                                        generate_rook_attacks_slow(sq2, 0)) | sq1_bb | sq2_bb;
+                between_table[sq1][sq2] = generate_rook_attacks_slow(sq1, sq2_bb) &
+                                          generate_rook_attacks_slow(sq2, sq1_bb);
+            } else if (generate_bishop_attacks_slow(sq1, 0) & sq2_bb) {
+                line_table[sq1][sq2] = (generate_bishop_attacks_slow(sq1, 0) &
+                                        generate_bishop_attacks_slow(sq2, 0)) | sq1_bb | sq2_bb;
+                between_table[sq1][sq2] = generate_bishop_attacks_slow(sq1, sq2_bb) &
+                                          generate_bishop_attacks_slow(sq2, sq1_bb);
+            }
+        }
+    }
+}
+
 Bitboard BitboardUtils::generate_rook_attacks_slow(int square, Bitboard occupancy) {
     Bitboard attacks = 0;
     int rank = get_rank(square);
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <array>
+#include <mutex>
 #include <string>
 #include <immintrin.h>  // For BMI2 and POPCNT intrinsics
 // TODO: Check the functions for each technology
@@ -66,7 +67,8 @@ class BitboardUtils {
 public:
     /**
      * Initialize magic bitboard tables and precomputed attack tables.
-     * Must be called once before using any attack generation functions.
+     * Must be called before using any attack generation functions.
+     * Thread-safe: concurrent first calls fill the tables exactly once.
      */
     static void init();
     
@@ -261,6 +263,42 @@ public:
      */
     static Bitboard pawn_attacks(int square, bool is_white);
     
+    // ========== Line Geometry Functions ==========
+    
+    /**
+     * Get the squares strictly between two squares on a shared rank, file or diagonal.
+     * Precomputed at init, so pin and check-mask code pays a single load.
+     * @param sq1 First square index (0-63)
+     * @param sq2 Second square index (0-63)
+     * @return Bitboard of the squares between sq1 and sq2 (endpoints excluded),
+     *         or 0 if the squares are not aligned
+     */
+    static Bitboard between_squares(int sq1, int sq2) {
+        return between_table[sq1][sq2];
+    }
+    
+    /**
+     * Get the full rank, file or diagonal running through two squares.
+     * The line spans edge to edge and includes both endpoints.
+     * @param sq1 First square index (0-63)
+     * @param sq2 Second square index (0-63)
+     * @return Bitboard of the line, or 0 if the squares are equal or not aligned
+     */
+    static Bitboard line_through(int sq1, int sq2) {
+        return line_table[sq1][sq2];
+    }
+    
+    /**
+     * Check whether three squares lie on a single rank, file or diagonal.
+     * @param sq1 First square index (0-63)
+     * @param sq2 Second square index (0-63), must differ from sq1
+     * @param sq3 Third square index (0-63)
+     * @return true if sq3 lies on the line through sq1 and sq2
+     */
+    static bool aligned(int sq1, int sq2, int sq3) {
+        return get_bit(line_table[sq1][sq2], sq3);
+    }
+    
     // ========== Utility Functions ==========
     
     /**
@@ -358,6 +396,10 @@ private:
     static std::array<Bitboard, 64> white_pawn_attacks_table;
     static std::array<Bitboard, 64> black_pawn_attacks_table;
     
+    // Pre-computed line geometry tables, indexed [sq1][sq2]
+    static std::array<std::array<Bitboard, 64>, 64> between_table;
+    static std::array<std::array<Bitboard, 64>, 64> line_table;
+    
     // Mask generation
     static Bitboard rook_mask(int square);
     static Bitboard bishop_mask(int square);
@@ -368,11 +410,17 @@ private:
     static void init_knight_attacks();
     static void init_king_attacks();
     static void init_pawn_attacks();
+    static void init_line_tables();
     
     static Bitboard generate_rook_attacks_slow(int square, Bitboard occupancy);
     static Bitboard generate_bishop_attacks_slow(int square, Bitboard occupancy);
     
-    static bool is_initialized;
+    static std::once_flag init_flag;
+    
+    /**
+     * Fill every attack and line table (run once by init()).
+     */
+    static void fill_tables();
 };
 
 #endif // BITBOARD_H
\ No newline at end of file
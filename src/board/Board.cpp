@@ -2,8 +2,9 @@
 #include <iostream>
 #include <sstream>
 #include <cctype>
+#include <cstdlib>
 #include <algorithm>
-#include "MoveGenerator.h"
+#include <mutex>
 
 // Castling lookup tables
 static const int CASTLING_ROOK_FROM[2] = {7, 0}; // [kingside, queenside]
@@ -11,15 +12,13 @@ static const int CASTLING_ROOK_TO[2] = {5, 3};
 
 // Lookup table for char to piece type conversion
 static Board::PieceType CHAR_TO_PIECE_LOOKUP[256];
-static bool char_lookup_initialized = false;
+static std::once_flag char_lookup_flag;
 
 // Castling rights masks for square-based updates
 static uint8_t CASTLING_RIGHTS_MASK[64];
-static bool castling_mask_initialized = false;
+static std::once_flag castling_mask_flag;
 
-void init_char_lookup() {
-    if (char_lookup_initialized) return;
-    
+static void fill_char_lookup() {
     // Initialize all to PAWN as default
     for (int i = 0; i < 256; i++) {
         CHAR_TO_PIECE_LOOKUP[i] = Board::PAWN;
@@ -38,13 +37,13 @@ void init_char_lookup() {
     CHAR_TO_PIECE_LOOKUP['Q'] = Board::QUEEN;
     CHAR_TO_PIECE_LOOKUP['k'] = Board::KING;
     CHAR_TO_PIECE_LOOKUP['K'] = Board::KING;
-    
-    char_lookup_initialized = true;
 }
 
-void init_castling_mask() {
-    if (castling_mask_initialized) return;
-    
+void init_char_lookup() {
+    std::call_once(char_lookup_flag, fill_char_lookup);
+}
+
+static void fill_castling_mask() {
     // Initialize all squares to preserve all rights
     for (int i = 0; i < 64; i++) {
         CASTLING_RIGHTS_MASK[i] = 0xFF;
@@ -58,8 +57,10 @@ void init_castling_mask() {
     CASTLING_RIGHTS_MASK[63] = ~0x04; // h8 - Black kingside rook
     CASTLING_RIGHTS_MASK[4] = ~0x03;  // e1 - White king (both White castling rights)
     CASTLING_RIGHTS_MASK[60] = ~0x0C; // e8 - Black king (both Black castling rights)
-    
-    castling_mask_initialized = true;
+}
+
+void init_castling_mask() {
+    std::call_once(castling_mask_flag, fill_castling_mask);
 }
 
 Board::Board() {
@@ -87,6 +88,11 @@ Board::Board() {
     // Initialize bitboard utilities if not already done
     BitboardUtils::init();
     
+    // Initialize Zobrist keys and hash the empty position
+    Zobrist::init();
+    hash_key = compute_hash_key();
+    pawn_key = compute_pawn_key();
+    
     // Initialize castling mask
     init_castling_mask();
     
@@ -116,7 +122,7 @@ void Board::set_from_fen(const std::string& fen) {
     
     std::istringstream iss(fen);
     std::string board_part, active_color_part, castling_part, en_passant_part;
-    int halfmove_part, fullmove_part;
+    int halfmove_part = 0, fullmove_part = 1;
     
     iss >> board_part >> active_color_part >> castling_part >> en_passant_part >> halfmove_part >> fullmove_part;
     
@@ -161,6 +167,91 @@ void Board::set_from_fen(const std::string& fen) {
     fullmove_number = fullmove_part;
     
     update_combined_bitboards();
+    
+    // Hash the freshly loaded position
+    hash_key = compute_hash_key();
+    pawn_key = compute_pawn_key();
+}
+
+bool Board::is_valid_fen(const std::string& fen) {
+    std::istringstream iss(fen);
+    std::string board_part, active_color_part, castling_part, en_passant_part, counter, extra;
+    if (!(iss >> board_part >> active_color_part >> castling_part >> en_passant_part)) {
+        return false;
+    }
+    
+    // Optional move counters, nothing after them
+    for (int i = 0; i < 2 && iss >> counter; ++i) {
+        bool digits = std::all_of(counter.begin(), counter.end(), [](unsigned char c) { return std::isdigit(c); });
+        if (!digits || counter.size() > 6) {
+            return false;
+        }
+    }
+    if (iss >> extra) {
+        return false;
+    }
+    
+    // Eight ranks of eight squares, one king per side, no pawn on a back rank
+    int rank = 7, file = 0;
+    int kings[NUM_COLORS] = {0, 0};
+    char squares[64];
+    std::fill(std::begin(squares), std::end(squares), '.');
+    for (char c : board_part) {
+        if (c == '/') {
+            if (file != 8 || rank == 0) {
+                return false;
+            }
+            rank--;
+            file = 0;
+        } else if (c >= '1' && c <= '8') {
+            file += c - '0';
+        } else if (std::string("PNBRQKpnbrqk").find(c) != std::string::npos) {
+            if (file >= 8 || ((c == 'P' || c == 'p') && (rank == 0 || rank == 7))) {
+                return false;
+            }
+            if (c == 'K' || c == 'k') {
+                kings[c == 'K' ? WHITE : BLACK]++;
+            }
+            squares[rank * 8 + file] = c;
+            file++;
+        } else {
+            return false;
+        }
+        if (file > 8) {
+            return false;
+        }
+    }
+    if (rank != 0 || file != 8 || kings[WHITE] != 1 || kings[BLACK] != 1) {
+        return false;
+    }
+    
+    if (active_color_part != "w" && active_color_part != "b") {
+        return false;
+    }
+    if (castling_part != "-" && (castling_part.size() > 4 ||
+        castling_part.find_first_not_of("KQkq") != std::string::npos)) {
+        return false;
+    }
+    
+    // Every castling right needs its king and rook still on their home squares
+    for (char right : castling_part) {
+        bool white = right == 'K' || right == 'Q';
+        int king_square = white ? 4 : 60;
+        int rook_square = (white ? 0 : 56) + (right == 'K' || right == 'k' ? 7 : 0);
+        if (right != '-' && (squares[king_square] != (white ? 'K' : 'k') ||
+                             squares[rook_square] != (white ? 'R' : 'r'))) {
+            return false;
+        }
+    }
+    if (en_passant_part != "-" && (en_passant_part.size() != 2 || en_passant_part[0] < 'a' ||
+        en_passant_part[0] > 'h' || (en_passant_part[1] != '3' && en_passant_part[1] != '6'))) {
+        return false;
+    }
+    
+    // The side that just moved cannot have left its king in check
+    Board board;
+    board.set_from_fen(fen);
+    return !board.is_in_check(board.get_active_color() == WHITE ? BLACK : WHITE);
 }
 
 std::string Board::to_fen() const {
@@ -245,6 +336,8 @@ void Board::clear_square(int square) {
         Color color = char_to_color(piece);
         BitboardUtils::clear_bit(piece_bitboards[color][piece_type], square);
         piece_mailbox[square] = '.';
+        hash_key ^= Zobrist::piece_key(color, piece_type, square);
+        if (piece_type == PAWN) pawn_key ^= Zobrist::piece_key(color, PAWN, square);
         update_combined_bitboards();
     }
 }
@@ -252,6 +345,8 @@ void Board::clear_square(int square) {
 void Board::place_piece(int square, PieceType piece_type, Color color) {
     BitboardUtils::set_bit(piece_bitboards[color][piece_type], square);
     piece_mailbox[square] = piece_to_char(piece_type, color);
+    hash_key ^= Zobrist::piece_key(color, piece_type, square);
+    if (piece_type == PAWN) pawn_key ^= Zobrist::piece_key(color, PAWN, square);
     
     // Update king position (branchless)
     king_positions[color] = (piece_type == KING) ? square : king_positions[color];
@@ -259,6 +354,60 @@ void Board::place_piece(int square, PieceType piece_type, Color color) {
     update_combined_bitboards();
 }
 
+void Board::set_active_color(Color color) {
+    if (color != active_color) hash_key ^= Zobrist::side_to_move_key();
+    active_color = color;
+}
+
+void Board::set_castling_rights(uint8_t rights) {
+    hash_key ^= Zobrist::castling_key(castling_rights) ^ Zobrist::castling_key(rights);
+    castling_rights = rights;
+}
+
+void Board::set_en_passant_file(int8_t file) {
+    if (en_passant_file != -1) hash_key ^= Zobrist::en_passant_key(en_passant_file);
+    if (file != -1) hash_key ^= Zobrist::en_passant_key(file);
+    en_passant_file = file;
+}
+
+uint64_t Board::compute_hash_key() const {
+    uint64_t key = 0;
+    
+    // Hash all pieces
+    for (int color = 0; color < NUM_COLORS; color++) {
+        for (int piece = 0; piece < NUM_PIECE_TYPES; piece++) {
+            Bitboard pieces = piece_bitboards[color][piece];
+            while (pieces) {
+                int square = BitboardUtils::pop_lsb(pieces);
+                key ^= Zobrist::piece_key(color, piece, square);
+            }
+        }
+    }
+    
+    // Hash castling rights, en passant and side to move
+    key ^= Zobrist::castling_key(castling_rights);
+    if (en_passant_file != -1) {
+        key ^= Zobrist::en_passant_key(en_passant_file);
+    }
+    if (active_color == BLACK) {
+        key ^= Zobrist::side_to_move_key();
+    }
+    
+    return key;
+}
+
+uint64_t Board::compute_pawn_key() const {
+    uint64_t key = 0;
+    for (int color = 0; color < NUM_COLORS; color++) {
+        Bitboard pawns = piece_bitboards[color][PAWN];
+        while (pawns) {
+            int square = BitboardUtils::pop_lsb(pawns);
+            key ^= Zobrist::piece_key(color, PAWN, square);
+        }
+    }
+    return key;
+}
+
 Bitboard Board::get_piece_bitboard(PieceType piece_type, Color color) const {
     return piece_bitboards[color][piece_type];
 }
@@ -278,40 +427,38 @@ bool Board::is_move_valid(const Move& move) const {
     }
     
     // Check if piece exists on source square
-    char piece_on_source = get_piece(move.from_rank, move.from_file);
-    if (piece_on_source == '.' || piece_on_source != move.piece) {
+    char piece_on_source = piece_mailbox[move.from_square()];
+    if (piece_on_source == '.' || piece_on_source != move.piece()) {
         return false;
     }
     
     // Check if it's the correct player's turn
-    Color piece_color = char_to_color(move.piece);
+    Color piece_color = static_cast<Color>(move.piece_color());
     if (piece_color != active_color) {
         return false;
     }
     
     // Check for friendly fire (capturing own pieces)
-    if (!move.is_en_passant) {
-        char target_piece = get_piece(move.to_rank, move.to_file);
+    if (!move.is_en_passant()) {
+        char target_piece = piece_mailbox[move.to_square()];
         if (target_piece != '.' && char_to_color(target_piece) == piece_color) {
             return false; // Cannot capture own pieces
         }
     }
     
     // For en passant, check if it's valid
-    if (move.is_en_passant) {
-        if (en_passant_file == -1 || move.to_file != en_passant_file) {
+    if (move.is_en_passant()) {
+        if (en_passant_file == -1 || move.to_file() != en_passant_file) {
             return false;
         }
-        PieceType piece_type = char_to_piece_type(move.piece);
-        if (piece_type != PAWN) {
+        if (move.piece_type() != PAWN) {
             return false;
         }
     }
     
     // For castling, perform basic validation
-    if (move.is_castling) {
-        PieceType piece_type = char_to_piece_type(move.piece);
-        if (piece_type != KING) {
+    if (move.is_castling()) {
+        if (move.piece_type() != KING) {
             return false;
         }
         // Additional castling validation would go here
@@ -320,12 +467,111 @@ bool Board::is_move_valid(const Move& move) const {
     return true;
 }
 
-bool Board::is_move_legal(const Move& move) {
-    MoveGenerator generator;
-    std::vector<Move> legal_moves = generator.generate_legal_moves(*this);
-    return std::any_of(legal_moves.begin(), legal_moves.end(), [&](const Move& m) {
-        return m == move;
-    });
+bool Board::is_pseudo_legal(const Move& move) const {
+    if (!is_move_valid(move)) {
+        return false;
+    }
+    
+    int from_square = move.from_square();
+    int to_square = move.to_square();
+    Bitboard to_bb = 1ULL << to_square;
+    PieceType piece_type = static_cast<PieceType>(move.piece_type());
+    Color color = static_cast<Color>(move.piece_color());
+    Color opponent = (color == WHITE) ? BLACK : WHITE;
+    char target = piece_mailbox[to_square];
+    
+    // En passant: diagonal pawn step onto the empty en passant square
+    if (move.is_en_passant()) {
+        int ep_rank = (color == WHITE) ? 5 : 2;
+        return target == '.' && move.to_rank() == ep_rank &&
+               move.captured_code() == Move::make_piece_code(PAWN, opponent) &&
+               (BitboardUtils::pawn_attacks(from_square, color == WHITE) & to_bb);
+    }
+    
+    // The captured piece recorded in the move must be the one actually standing there
+    if (move.captured_code() != Move::char_to_code(target) || (target != '.' && char_to_piece_type(target) == KING)) {
+        return false;
+    }
+    
+    // Pawns reaching the last rank must promote, and only they may
+    bool reaches_last_rank = piece_type == PAWN && move.to_rank() == (color == WHITE ? 7 : 0);
+    if (reaches_last_rank != move.is_promotion()) {
+        return false;
+    }
+    if (move.is_promotion() && (move.promotion_type() < KNIGHT || move.promotion_type() > QUEEN ||
+                                move.promotion_code() >> 3 != color)) {
+        return false;
+    }
+    
+    // Castling: rights, empty path and no attacked square on the king's way
+    if (move.is_castling()) {
+        int home_square = (color == WHITE) ? E1 : E8;
+        if (from_square != home_square || target != '.') return false;
+        
+        bool kingside = (to_square == from_square + 2);
+        if (!kingside && to_square != from_square - 2) return false;
+        
+        uint8_t required_right = (color == WHITE) ? (kingside ? 0x01 : 0x02) : (kingside ? 0x04 : 0x08);
+        if (!(castling_rights & required_right)) return false;
+        
+        int rook_square = from_square + (kingside ? 3 : -4);
+        if (piece_mailbox[rook_square] != piece_to_char(ROOK, color)) return false;
+        
+        return (BitboardUtils::between_squares(from_square, rook_square) & all_pieces) == 0;
+    }
+    
+    switch (piece_type) {
+        case PAWN: {
+            if (target != '.') {
+                return (BitboardUtils::pawn_attacks(from_square, color == WHITE) & to_bb) != 0;
+            }
+            int forward = (color == WHITE) ? 8 : -8;
+            if (to_square == from_square + forward) return true;
+            int start_rank = (color == WHITE) ? 1 : 6;
+            return move.from_rank() == start_rank && to_square == from_square + 2 * forward &&
+                   piece_mailbox[from_square + forward] == '.';
+        }
+        case KNIGHT: return (BitboardUtils::knight_attacks(from_square) & to_bb) != 0;
+        case BISHOP: return (BitboardUtils::bishop_attacks(from_square, all_pieces) & to_bb) != 0;
+        case ROOK:   return (BitboardUtils::rook_attacks(from_square, all_pieces) & to_bb) != 0;
+        case QUEEN:  return (BitboardUtils::queen_attacks(from_square, all_pieces) & to_bb) != 0;
+        case KING:   return (BitboardUtils::king_attacks(from_square) & to_bb) != 0;
+        default:     return false;
+    }
+}
+
+bool Board::is_move_legal(const Move& move) const {
+    if (!is_pseudo_legal(move)) {
+        return false;
+    }
+    
+    Color color = static_cast<Color>(move.piece_color());
+    Color opponent = (color == WHITE) ? BLACK : WHITE;
+    int from_square = move.from_square();
+    int to_square = move.to_square();
+    
+    // Castling may not start from, pass through or land on an attacked square
+    if (move.is_castling()) {
+        int step = (to_square > from_square) ? 1 : -1;
+        for (int square = from_square; square != to_square + step; square += step) {
+            if (is_square_attacked(square, opponent)) return false;
+        }
+        return true;
+    }
+    
+    bool king_move = move.piece_type() == KING;
+    int king_square = king_move ? to_square : king_positions[color];
+    if (king_square == -1) return true;
+    
+    // Look at the king from the position after the move: the mover leaves its
+    // square, lands on the target and the captured piece disappears. This
+    // covers pins, check evasions and en passant discovered checks at once.
+    Bitboard captured_bb = move.is_en_passant()
+        ? 1ULL << (color == WHITE ? to_square - 8 : to_square + 8)
+        : 1ULL << to_square;
+    Bitboard occupancy = (all_pieces & ~(1ULL << from_square) & ~captured_bb) | (1ULL << to_square);
+    
+    return (get_attackers_to_square(king_square, opponent, occupancy) & ~captured_bb) == 0;
 }
 
 BitboardMoveUndoData Board::make_move(const Move& move) {
@@ -337,22 +583,24 @@ BitboardMoveUndoData Board::apply_move(const Move& move) {
     // Store undo data
     BitboardMoveUndoData undo_data;
     undo_data.move = move;
-    undo_data.captured_piece = move.captured_piece;
+    undo_data.captured_piece = move.captured_piece();
     undo_data.castling_rights = castling_rights;
     undo_data.en_passant_file = en_passant_file;
     undo_data.halfmove_clock = halfmove_clock;
+    undo_data.hash_key = hash_key;
+    undo_data.pawn_key = pawn_key;
     
-    int from_square = BitboardUtils::square_index(move.from_rank, move.from_file);
-    int to_square = BitboardUtils::square_index(move.to_rank, move.to_file);
+    int from_square = move.from_square();
+    int to_square = move.to_square();
     
-    // Cache piece type and color lookups
-    PieceType moving_piece_type = char_to_piece_type(move.piece);
-    Color moving_color = char_to_color(move.piece);
+    // Piece type and color come straight from the packed move
+    PieceType moving_piece_type = static_cast<PieceType>(move.piece_type());
+    Color moving_color = static_cast<Color>(move.piece_color());
     Color opponent_color = (moving_color == WHITE) ? BLACK : WHITE;
     
     // Handle captures (store captured piece if not already set)
-    if (undo_data.captured_piece == '.' && !move.is_en_passant) {
-        undo_data.captured_piece = get_piece(move.to_rank, move.to_file);
+    if (undo_data.captured_piece == '.' && !move.is_en_passant()) {
+        undo_data.captured_piece = piece_mailbox[to_square];
     }
     
     // Clear source square from mailbox
@@ -360,56 +608,68 @@ BitboardMoveUndoData Board::apply_move(const Move& move) {
     
     // Remove piece from source square bitboard
     BitboardUtils::clear_bit(piece_bitboards[moving_color][moving_piece_type], from_square);
+    hash_key ^= Zobrist::piece_key(moving_color, moving_piece_type, from_square);
+    if (moving_piece_type == PAWN) pawn_key ^= Zobrist::piece_key(moving_color, PAWN, from_square);
     
     // Handle captures
-    if (move.is_en_passant) {
+    if (move.is_en_passant()) {
         // En passant capture - remove the captured pawn
-        int captured_pawn_rank = (moving_color == WHITE) ? move.to_rank - 1 : move.to_rank + 1;
-        int captured_pawn_square = BitboardUtils::square_index(captured_pawn_rank, move.to_file);
+        int captured_pawn_square = (moving_color == WHITE) ? to_square - 8 : to_square + 8;
         BitboardUtils::clear_bit(piece_bitboards[opponent_color][PAWN], captured_pawn_square);
         piece_mailbox[captured_pawn_square] = '.';
+        hash_key ^= Zobrist::piece_key(opponent_color, PAWN, captured_pawn_square);
+        pawn_key ^= Zobrist::piece_key(opponent_color, PAWN, captured_pawn_square);
     } else if (undo_data.captured_piece != '.') {
         // Normal capture - remove captured piece from destination square
         PieceType captured_piece_type = char_to_piece_type(undo_data.captured_piece);
         Color captured_color = char_to_color(undo_data.captured_piece);
         BitboardUtils::clear_bit(piece_bitboards[captured_color][captured_piece_type], to_square);
+        hash_key ^= Zobrist::piece_key(captured_color, captured_piece_type, to_square);
+        if (captured_piece_type == PAWN) pawn_key ^= Zobrist::piece_key(captured_color, PAWN, to_square);
     }
     
     // Place piece on destination square
-    if (move.promotion_piece != '.') {
+    if (move.is_promotion()) {
         // Handle promotion
-        PieceType promotion_type = char_to_piece_type(move.promotion_piece);
+        PieceType promotion_type = static_cast<PieceType>(move.promotion_type());
         BitboardUtils::set_bit(piece_bitboards[moving_color][promotion_type], to_square);
-        piece_mailbox[to_square] = move.promotion_piece;
+        piece_mailbox[to_square] = move.promotion_piece();
+        hash_key ^= Zobrist::piece_key(moving_color, promotion_type, to_square);
     } else {
         BitboardUtils::set_bit(piece_bitboards[moving_color][moving_piece_type], to_square);
-        piece_mailbox[to_square] = move.piece;
+        piece_mailbox[to_square] = move.piece();
+        hash_key ^= Zobrist::piece_key(moving_color, moving_piece_type, to_square);
+        if (moving_piece_type == PAWN) pawn_key ^= Zobrist::piece_key(moving_color, PAWN, to_square);
     }
     
     // Update king position if king moved (branchless)
     king_positions[moving_color] = (moving_piece_type == KING) ? to_square : king_positions[moving_color];
     
     // Handle castling
-    if (move.is_castling) {
-        int castling_side = (move.to_file == 6) ? 0 : 1; // 0=kingside, 1=queenside
-        int rook_from_square = BitboardUtils::square_index(move.from_rank, CASTLING_ROOK_FROM[castling_side]);
-        int rook_to_square = BitboardUtils::square_index(move.from_rank, CASTLING_ROOK_TO[castling_side]);
+    if (move.is_castling()) {
+        int castling_side = (move.to_file() == 6) ? 0 : 1; // 0=kingside, 1=queenside
+        int rook_from_square = BitboardUtils::square_index(move.from_rank(), CASTLING_ROOK_FROM[castling_side]);
+        int rook_to_square = BitboardUtils::square_index(move.from_rank(), CASTLING_ROOK_TO[castling_side]);
         
         BitboardUtils::clear_bit(piece_bitboards[moving_color][ROOK], rook_from_square);
         BitboardUtils::set_bit(piece_bitboards[moving_color][ROOK], rook_to_square);
         piece_mailbox[rook_from_square] = '.';
         piece_mailbox[rook_to_square] = piece_to_char(ROOK, moving_color);
+        hash_key ^= Zobrist::piece_key(moving_color, ROOK, rook_from_square) ^
+                    Zobrist::piece_key(moving_color, ROOK, rook_to_square);
     }
     
     // Update castling rights using lookup table
+    hash_key ^= Zobrist::castling_key(castling_rights);
     castling_rights &= CASTLING_RIGHTS_MASK[from_square];
     castling_rights &= CASTLING_RIGHTS_MASK[to_square];
+    hash_key ^= Zobrist::castling_key(castling_rights);
     
     // Update en passant file (branchless)
-    bool is_double_pawn_move = (moving_piece_type == PAWN) && 
-        ((moving_color == WHITE && move.to_rank - move.from_rank == 2) ||
-         (moving_color == BLACK && move.from_rank - move.to_rank == 2));
-    en_passant_file = is_double_pawn_move ? move.from_file : -1;
+    if (en_passant_file != -1) hash_key ^= Zobrist::en_passant_key(en_passant_file);
+    bool is_double_pawn_move = (moving_piece_type == PAWN) && (std::abs(to_square - from_square) == 16);
+    en_passant_file = is_double_pawn_move ? move.from_file() : -1;
+    if (en_passant_file != -1) hash_key ^= Zobrist::en_passant_key(en_passant_file);
     
     // Update halfmove clock (branchless)
     bool reset_halfmove = (moving_piece_type == PAWN) || (undo_data.captured_piece != '.');
@@ -420,18 +680,52 @@ BitboardMoveUndoData Board::apply_move(const Move& move) {
     
     // Switch active color
     active_color = opponent_color;
+    hash_key ^= Zobrist::side_to_move_key();
     
     update_combined_bitboards();
     return undo_data;
 }
 
+BitboardMoveUndoData Board::make_null_move() {
+    BitboardMoveUndoData undo_data;
+    undo_data.castling_rights = castling_rights;
+    undo_data.en_passant_file = en_passant_file;
+    undo_data.halfmove_clock = halfmove_clock;
+    undo_data.hash_key = hash_key;
+    undo_data.pawn_key = pawn_key;
+    
+    // An en passant capture is only available on the very next move
+    if (en_passant_file != -1) {
+        hash_key ^= Zobrist::en_passant_key(en_passant_file);
+        en_passant_file = -1;
+    }
+    
+    halfmove_clock++;
+    active_color = (active_color == WHITE) ? BLACK : WHITE;
+    hash_key ^= Zobrist::side_to_move_key();
+    
+    return undo_data;
+}
+
+void Board::undo_null_move(const BitboardMoveUndoData& undo_data) {
+    en_passant_file = undo_data.en_passant_file;
+    halfmove_clock = undo_data.halfmove_clock;
+    hash_key = undo_data.hash_key;
+    active_color = (active_color == WHITE) ? BLACK : WHITE;
+}
+
 void Board::undo_move(const BitboardMoveUndoData& undo_data) {
     const Move& move = undo_data.move;
     
+    // Empty undo data (from a rejected make_move) leaves the board untouched
+    if (move.is_null()) return;
+    
     // Restore game state
     castling_rights = undo_data.castling_rights;
     en_passant_file = undo_data.en_passant_file;
     halfmove_clock = undo_data.halfmove_clock;
+    hash_key = undo_data.hash_key;
+    pawn_key = undo_data.pawn_key;
     
     // Switch back active color
     active_color = (active_color == WHITE) ? BLACK : WHITE;
@@ -439,19 +733,19 @@ void Board::undo_move(const BitboardMoveUndoData& undo_data) {
     // Update fullmove number (branchless)
     fullmove_number -= (active_color == BLACK);
     
-    int from_square = BitboardUtils::square_index(move.from_rank, move.from_file);
-    int to_square = BitboardUtils::square_index(move.to_rank, move.to_file);
+    int from_square = move.from_square();
+    int to_square = move.to_square();
     
-    // Cache piece type and color lookups
-    PieceType moving_piece_type = char_to_piece_type(move.piece);
-    Color moving_color = char_to_color(move.piece);
+    // Piece type and color come straight from the packed move
+    PieceType moving_piece_type = static_cast<PieceType>(move.piece_type());
+    Color moving_color = static_cast<Color>(move.piece_color());
     Color opponent_color = (moving_color == WHITE) ? BLACK : WHITE;
     
     // Handle castling undo
-    if (move.is_castling) {
-        int castling_side = (move.to_file == 6) ? 0 : 1; // 0=kingside, 1=queenside
-        int rook_from_square = BitboardUtils::square_index(move.from_rank, CASTLING_ROOK_FROM[castling_side]);
-        int rook_to_square = BitboardUtils::square_index(move.from_rank, CASTLING_ROOK_TO[castling_side]);
+    if (move.is_castling()) {
+        int castling_side = (move.to_file() == 6) ? 0 : 1; // 0=kingside, 1=queenside
+        int rook_from_square = BitboardUtils::square_index(move.from_rank(), CASTLING_ROOK_FROM[castling_side]);
+        int rook_to_square = BitboardUtils::square_index(move.from_rank(), CASTLING_ROOK_TO[castling_side]);
         
         // Move rook back
         BitboardUtils::clear_bit(piece_bitboards[moving_color][ROOK], rook_to_square);
@@ -461,9 +755,9 @@ void Board::undo_move(const BitboardMoveUndoData& undo_data) {
     }
     
     // Remove piece from destination square
-    if (move.promotion_piece != '.') {
+    if (move.is_promotion()) {
         // Undo promotion
-        PieceType promotion_type = char_to_piece_type(move.promotion_piece);
+        PieceType promotion_type = static_cast<PieceType>(move.promotion_type());
         BitboardUtils::clear_bit(piece_bitboards[moving_color][promotion_type], to_square);
     } else {
         BitboardUtils::clear_bit(piece_bitboards[moving_color][moving_piece_type], to_square);
@@ -471,17 +765,16 @@ void Board::undo_move(const BitboardMoveUndoData& undo_data) {
     
     // Place piece back on source square
     BitboardUtils::set_bit(piece_bitboards[moving_color][moving_piece_type], from_square);
-    piece_mailbox[from_square] = move.piece;
+    piece_mailbox[from_square] = move.piece();
     piece_mailbox[to_square] = '.';
     
     // Update king position if king moved (branchless)
     king_positions[moving_color] = (moving_piece_type == KING) ? from_square : king_positions[moving_color];
     
     // Restore captured piece
-    if (move.is_en_passant) {
+    if (move.is_en_passant()) {
         // Restore en passant captured pawn
-        int captured_pawn_rank = (moving_color == WHITE) ? move.to_rank - 1 : move.to_rank + 1;
-        int captured_pawn_square = BitboardUtils::square_index(captured_pawn_rank, move.to_file);
+        int captured_pawn_square = (moving_color == WHITE) ? to_square - 8 : to_square + 8;
         BitboardUtils::set_bit(piece_bitboards[opponent_color][PAWN], captured_pawn_square);
         piece_mailbox[captured_pawn_square] = piece_to_char(PAWN, opponent_color);
     } else if (undo_data.captured_piece != '.') {
@@ -502,6 +795,10 @@ bool Board::is_square_attacked(int square, Color attacking_color) const {
     return get_attackers_to_square(square, attacking_color) != 0;
 }
 
+bool Board::is_square_attacked(int square, Color attacking_color, Bitboard occupancy) const {
+    return get_attackers_to_square(square, attacking_color, occupancy) != 0;
+}
+
 bool Board::is_in_check(Color color) const {
     int king_square = king_positions[color];
     if (king_square == -1) return false;
@@ -572,6 +869,10 @@ void Board::update_king_position(Color color) {
 }
 
 Bitboard Board::get_attackers_to_square(int square, Color attacking_color) const {
+    return get_attackers_to_square(square, attacking_color, all_pieces);
+}
+
+Bitboard Board::get_attackers_to_square(int square, Color attacking_color, Bitboard occupancy) const {
     Bitboard attackers = 0;
     
     // Pawn attacks
@@ -583,11 +884,11 @@ Bitboard Board::get_attackers_to_square(int square, Color attacking_color) const
     attackers |= knight_attacks & piece_bitboards[attacking_color][KNIGHT];
     
     // Bishop/Queen diagonal attacks
-    Bitboard bishop_attacks = BitboardUtils::bishop_attacks(square, all_pieces);
+    Bitboard bishop_attacks = BitboardUtils::bishop_attacks(square, occupancy);
     attackers |= bishop_attacks & (piece_bitboards[attacking_color][BISHOP] | piece_bitboards[attacking_color][QUEEN]);
     
     // Rook/Queen straight attacks
-    Bitboard rook_attacks = BitboardUtils::rook_attacks(square, all_pieces);
+    Bitboard rook_attacks = BitboardUtils::rook_attacks(square, occupancy);
     attackers |= rook_attacks & (piece_bitboards[attacking_color][ROOK] | piece_bitboards[attacking_color][QUEEN]);
     
     // King attacks
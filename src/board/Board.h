@@ -3,6 +3,7 @@
 
 #include "Bitboard.h"
 #include "Move.h"
+#include "Zobrist.h"
 #include <string>
 #include <array>
 
@@ -56,6 +57,10 @@ private:
     // Piece mailbox for O(1) square access
     char piece_mailbox[64];
     
+    // Zobrist keys, maintained incrementally by every board mutation
+    uint64_t hash_key;  // Full position key (pieces, castling, en passant, side to move)
+    uint64_t pawn_key;  // Key over pawns only, for the pawn structure cache
+    
 public:
     Board();
     
@@ -63,6 +68,19 @@ public:
     void set_starting_position();
     void set_from_fen(const std::string& fen);
     
+    /**
+     * @brief Check that a FEN string describes a position set_from_fen() can load
+     * 
+     * Requires eight ranks of eight squares, one king per side, no pawns on
+     * the first or last rank, valid side to move, castling and en passant
+     * fields, and that the side not to move is not in check. The two move
+     * counters may be omitted.
+     * 
+     * @param fen FEN string from an untrusted source
+     * @return true if the position is valid
+     */
+    [[nodiscard]] static bool is_valid_fen(const std::string& fen);
+    
     /**
      * @brief Convert the current board position to FEN notation
      * 
@@ -87,14 +105,14 @@ public:
     
     // Game state access
     [[nodiscard]] Color get_active_color() const { return active_color; }
-    void set_active_color(Color color) { active_color = color; }
+    void set_active_color(Color color);
     [[nodiscard]] char get_active_color_char() const { return active_color == WHITE ? 'w' : 'b'; }
     
     [[nodiscard]] uint8_t get_castling_rights() const { return castling_rights; }
-    void set_castling_rights(uint8_t rights) { castling_rights = rights; }
+    void set_castling_rights(uint8_t rights);
     
     [[nodiscard]] int8_t get_en_passant_file() const { return en_passant_file; }
-    void set_en_passant_file(int8_t file) { en_passant_file = file; }
+    void set_en_passant_file(int8_t file);
     
     [[nodiscard]] int get_halfmove_clock() const { return halfmove_clock; }
     void set_halfmove_clock(int clock) { halfmove_clock = clock; }
@@ -104,20 +122,54 @@ public:
     
     [[nodiscard]] int get_king_position(Color color) const { return king_positions[color]; }
     
+    // Position hashing
+    [[nodiscard]] uint64_t get_hash_key() const { return hash_key; }
+    [[nodiscard]] uint64_t get_pawn_key() const { return pawn_key; }
+    
+    /**
+     * @brief Compute the position key from scratch
+     * 
+     * Walks every piece and the game state. Used when loading a position
+     * and to verify the incrementally maintained key.
+     * 
+     * @return 64-bit Zobrist key of the current position
+     */
+    [[nodiscard]] uint64_t compute_hash_key() const;
+    
+    /**
+     * @brief Compute the pawn-only key from scratch
+     * 
+     * @return 64-bit Zobrist key over the pawns of both colors
+     */
+    [[nodiscard]] uint64_t compute_pawn_key() const;
+    
     // Move operations
     [[nodiscard]] bool is_move_valid(const Move& move) const;
     
+    /**
+     * @brief Check if a move is pseudo-legal in the current position
+     * 
+     * Verifies in constant time that the move could have come from the move
+     * generator: the right piece moves along a path open to it, the recorded
+     * capture matches the board, promotions happen exactly on the last rank and
+     * castling has its rights and an empty path. King safety is not checked.
+     * 
+     * @param move The move to check
+     * @return true if the move is pseudo-legal, false otherwise
+     */
+    [[nodiscard]] bool is_pseudo_legal(const Move& move) const;
+    
     /**
      * @brief Check if a move is legal in the current position
      * 
-     * Determines if a move is legal by generating all legal moves
-     * and checking if the given move is among them. This ensures
-     * the move doesn't leave the king in check.
+     * Checks pseudo-legality and then that the move does not leave the king in
+     * check, by testing the king square against the occupancy after the move.
+     * Runs in constant time without generating moves or touching the board.
      * 
      * @param move The move to check for legality
      * @return true if the move is legal, false otherwise
      */
-    bool is_move_legal(const Move& move);
+    [[nodiscard]] bool is_move_legal(const Move& move) const;
     
     /**
      * @brief Make a move on the board if it's legal
@@ -144,8 +196,27 @@ public:
     BitboardMoveUndoData apply_move(const Move& move);
     void undo_move(const BitboardMoveUndoData& undo_data);
     
+    /**
+     * @brief Pass the turn to the opponent without moving a piece
+     * 
+     * Flips the side to move, clears the en passant file and updates the
+     * Zobrist key accordingly. Used by null-move pruning; the side to move
+     * must not be in check.
+     * 
+     * @return BitboardMoveUndoData (with a null move) for undo_null_move
+     */
+    BitboardMoveUndoData make_null_move();
+    
+    /**
+     * @brief Take back a null move made with make_null_move
+     * 
+     * @param undo_data Undo data returned by make_null_move
+     */
+    void undo_null_move(const BitboardMoveUndoData& undo_data);
+    
     // Attack and check detection
     [[nodiscard]] bool is_square_attacked(int square, Color attacking_color) const;
+    [[nodiscard]] bool is_square_attacked(int square, Color attacking_color, Bitboard occupancy) const;
     [[nodiscard]] bool is_in_check(Color color) const;
     
     // Utility functions
@@ -162,6 +233,7 @@ private:
     void update_combined_bitboards();
     void update_king_position(Color color);
     [[nodiscard]] Bitboard get_attackers_to_square(int square, Color attacking_color) const;
+    [[nodiscard]] Bitboard get_attackers_to_square(int square, Color attacking_color, Bitboard occupancy) const;
 };
 
 /**
@@ -173,9 +245,12 @@ struct BitboardMoveUndoData {
     uint8_t castling_rights;
     int8_t en_passant_file;
     int halfmove_clock;
+    uint64_t hash_key;
+    uint64_t pawn_key;
     
     BitboardMoveUndoData() : captured_piece('.'), castling_rights(0), 
-                            en_passant_file(-1), halfmove_clock(0) {}
+                            en_passant_file(-1), halfmove_clock(0),
+                            hash_key(0), pawn_key(0) {}
 };
 
 #endif // BITBOARD_BOARD_H
\ No newline at end of file
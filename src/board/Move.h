@@ -3,59 +3,137 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cctype>
 #include <iostream>
 
 /**
- * @brief Structure representing a chess move
- * 
- * Contains all information needed to represent and execute a chess move,
- * including source and destination squares, piece information, special move flags,
- * and captured pieces.
- * 
- * @note TODO: Look into using a more efficient representation for moves
+ * @brief Packed 32-bit representation of a chess move
+ *
+ * The whole move fits in a single register so that move lists and undo
+ * records stay small and comparisons are a single integer compare.
+ *
+ * Bit layout:
+ *   bits  0-5  : source square (0-63, rank * 8 + file)
+ *   bits  6-11 : destination square (0-63)
+ *   bits 12-15 : moving piece code
+ *   bits 16-19 : captured piece code (0 if none)
+ *   bits 20-23 : promotion piece code (0 if none)
+ *   bit  24    : castling flag
+ *   bit  25    : en passant flag
+ *
+ * A piece code is 0 for "no piece", otherwise (color << 3) | (piece_type + 1)
+ * using the Board::PieceType / Board::Color numbering.
  */
 struct Move {
-    int from_rank;
-    int from_file;
-    int to_rank;
-    int to_file;
-    char piece;           // The piece being moved
-    char captured_piece;  // The piece being captured (if any), '.' if none
-    char promotion_piece; // The piece to promote to (if any), '.' if none
-    bool is_castling;     // True if this is a castling move
-    bool is_en_passant;   // True if this is an en passant capture
-    
+    // Piece code helpers
+    static constexpr uint8_t NO_PIECE = 0;
+
+    // Flag bits
+    static constexpr uint32_t CASTLING_FLAG = 1u << 24;
+    static constexpr uint32_t EN_PASSANT_FLAG = 1u << 25;
+
+    /**
+     * @brief Build a piece code from a piece type and color
+     *
+     * @param piece_type Piece type index (0=pawn ... 5=king)
+     * @param color Color index (0=white, 1=black)
+     * @return 4-bit piece code
+     */
+    static constexpr uint8_t make_piece_code(int piece_type, int color) {
+        return static_cast<uint8_t>((color << 3) | (piece_type + 1));
+    }
+
+    /**
+     * @brief Convert a piece character ('P', 'n', '.', ...) to a piece code
+     *
+     * @param piece Character representing the piece
+     * @return 4-bit piece code, NO_PIECE for '.' or unknown characters
+     */
+    static constexpr uint8_t char_to_code(char piece) {
+        switch (piece) {
+            case 'P': return make_piece_code(0, 0);
+            case 'N': return make_piece_code(1, 0);
+            case 'B': return make_piece_code(2, 0);
+            case 'R': return make_piece_code(3, 0);
+            case 'Q': return make_piece_code(4, 0);
+            case 'K': return make_piece_code(5, 0);
+            case 'p': return make_piece_code(0, 1);
+            case 'n': return make_piece_code(1, 1);
+            case 'b': return make_piece_code(2, 1);
+            case 'r': return make_piece_code(3, 1);
+            case 'q': return make_piece_code(4, 1);
+            case 'k': return make_piece_code(5, 1);
+            default: return NO_PIECE;
+        }
+    }
+
+    /**
+     * @brief Convert a piece code back to its character representation
+     *
+     * @param code 4-bit piece code
+     * @return Piece character, '.' for NO_PIECE
+     */
+    static constexpr char code_to_char(uint8_t code) {
+        constexpr char chars[16] = {'.', 'P', 'N', 'B', 'R', 'Q', 'K', '.',
+                                    '.', 'p', 'n', 'b', 'r', 'q', 'k', '.'};
+        return chars[code & 0xF];
+    }
+
+    /**
+     * @brief Create a move directly from square indices and piece codes
+     *
+     * This is the fast path used by the move generator.
+     *
+     * @param from Source square (0-63)
+     * @param to Destination square (0-63)
+     * @param piece Moving piece code
+     * @param captured Captured piece code (NO_PIECE if none)
+     * @param promotion Promotion piece code (NO_PIECE if none)
+     * @param flags CASTLING_FLAG and/or EN_PASSANT_FLAG
+     * @return The packed move
+     */
+    static constexpr Move make(int from, int to, uint8_t piece, uint8_t captured = NO_PIECE,
+                               uint8_t promotion = NO_PIECE, uint32_t flags = 0) {
+        Move move;
+        move.data = static_cast<uint32_t>(from) | (static_cast<uint32_t>(to) << 6) |
+                    (static_cast<uint32_t>(piece) << 12) | (static_cast<uint32_t>(captured) << 16) |
+                    (static_cast<uint32_t>(promotion) << 20) | flags;
+        return move;
+    }
+
     /**
      * @brief Default constructor
-     * 
-     * Creates an empty move with all fields initialized to default values.
+     *
+     * Creates an empty (null) move.
      */
-    Move() : from_rank(0), from_file(0), to_rank(0), to_file(0), 
-             piece('.'), captured_piece('.'), promotion_piece('.'),
-             is_castling(false), is_en_passant(false) {}
-    
+    constexpr Move() : data(0) {}
+
     /**
      * @brief Constructor with basic move information
-     * 
+     *
      * Creates a move with source and destination coordinates and the moving piece.
-     * Other fields are set to default values.
-     * 
+     * Other fields are set to default values. Coordinates outside the board
+     * produce a null move, which fails is_valid().
+     *
      * @param fr Source rank (0-7)
      * @param ff Source file (0-7)
      * @param tr Destination rank (0-7)
      * @param tf Destination file (0-7)
      * @param p Character representing the moving piece
      */
-    Move(int fr, int ff, int tr, int tf, char p) 
-        : from_rank(fr), from_file(ff), to_rank(tr), to_file(tf), piece(p),
-          captured_piece('.'), promotion_piece('.'), is_castling(false), is_en_passant(false) {}
-    
+    Move(int fr, int ff, int tr, int tf, char p) : Move(fr, ff, tr, tf, p, '.') {}
+
     /**
      * @brief Constructor with complete move information
-     * 
+     *
      * Creates a move with all possible information including captures,
-     * promotions, and special move flags.
-     * 
+     * promotions, and special move flags. Coordinates outside the board
+     * produce a null move, which fails is_valid().
+     *
      * @param fr Source rank (0-7)
      * @param ff Source file (0-7)
      * @param tr Destination rank (0-7)
@@ -67,67 +145,135 @@ struct Move {
      * @param ep True if this is an en passant capture
      */
     Move(int fr, int ff, int tr, int tf, char p, char cap, char prom = '.', bool castle = false, bool ep = false)
-        : from_rank(fr), from_file(ff), to_rank(tr), to_file(tf), piece(p),
-          captured_piece(cap), promotion_piece(prom), is_castling(castle), is_en_passant(ep) {}
-    
+        : data(0) {
+        if (fr < 0 || fr > 7 || ff < 0 || ff > 7 || tr < 0 || tr > 7 || tf < 0 || tf > 7) {
+            return;
+        }
+        *this = make(fr * 8 + ff, tr * 8 + tf, char_to_code(p), char_to_code(cap), char_to_code(prom),
+                     (castle ? CASTLING_FLAG : 0) | (ep ? EN_PASSANT_FLAG : 0));
+    }
+
+    // Square accessors
+    constexpr int from_square() const { return static_cast<int>(data & 0x3F); }
+    constexpr int to_square() const { return static_cast<int>((data >> 6) & 0x3F); }
+    constexpr int from_rank() const { return from_square() >> 3; }
+    constexpr int from_file() const { return from_square() & 7; }
+    constexpr int to_rank() const { return to_square() >> 3; }
+    constexpr int to_file() const { return to_square() & 7; }
+
+    // Piece code accessors
+    constexpr uint8_t piece_code() const { return static_cast<uint8_t>((data >> 12) & 0xF); }
+    constexpr uint8_t captured_code() const { return static_cast<uint8_t>((data >> 16) & 0xF); }
+    constexpr uint8_t promotion_code() const { return static_cast<uint8_t>((data >> 20) & 0xF); }
+
+    /**
+     * @brief Piece type of the moving piece (0=pawn ... 5=king, -1 if none)
+     */
+    constexpr int piece_type() const { return (piece_code() & 7) - 1; }
+
+    /**
+     * @brief Color of the moving piece (0=white, 1=black)
+     */
+    constexpr int piece_color() const { return piece_code() >> 3; }
+
+    /**
+     * @brief Piece type of the captured piece (-1 if none)
+     */
+    constexpr int captured_type() const { return (captured_code() & 7) - 1; }
+
+    /**
+     * @brief Piece type of the promotion piece (-1 if none)
+     */
+    constexpr int promotion_type() const { return (promotion_code() & 7) - 1; }
+
+    // Character accessors (conversion layer for the mailbox and printing code)
+    constexpr char piece() const { return code_to_char(piece_code()); }
+    constexpr char captured_piece() const { return code_to_char(captured_code()); }
+    constexpr char promotion_piece() const { return code_to_char(promotion_code()); }
+
+    // Flag accessors
+    constexpr bool is_castling() const { return (data & CASTLING_FLAG) != 0; }
+    constexpr bool is_en_passant() const { return (data & EN_PASSANT_FLAG) != 0; }
+
+    /**
+     * @brief Check if this is the empty (null) move
+     */
+    constexpr bool is_null() const { return data == 0; }
+
+    /**
+     * @brief Raw packed representation
+     */
+    constexpr uint32_t raw() const { return data; }
+
+    /**
+     * @brief Rebuild a move from its raw packed representation
+     *
+     * @param raw Value previously obtained from raw()
+     * @return The move with exactly that encoding
+     */
+    static constexpr Move from_raw(uint32_t raw) {
+        Move move;
+        move.data = raw;
+        return move;
+    }
+
     /**
      * @brief Convert move to algebraic notation
-     * 
+     *
      * Converts the move to standard algebraic notation (e.g., "e2e4").
      * Includes promotion piece suffix if applicable.
-     * 
+     *
      * @return String representation in algebraic notation
      */
     std::string to_algebraic() const {
         std::string result = "";
-        result += static_cast<char>('a' + from_file);
-        result += static_cast<char>('1' + from_rank);
-        result += static_cast<char>('a' + to_file);
-        result += static_cast<char>('1' + to_rank);
-        
+        result += static_cast<char>('a' + from_file());
+        result += static_cast<char>('1' + from_rank());
+        result += static_cast<char>('a' + to_file());
+        result += static_cast<char>('1' + to_rank());
+
         // Add promotion piece if applicable
-        if (promotion_piece != '.') {
-            result += std::tolower(promotion_piece);
+        if (is_promotion()) {
+            result += static_cast<char>(std::tolower(promotion_piece()));
         }
-        
+
         return result;
     }
-    
+
     /**
      * @brief Check if this is a valid move (basic validation)
-     * 
-     * Performs basic validation to ensure the move has valid coordinates,
-     * a valid piece, and the source and destination are different.
-     * 
+     *
+     * Performs basic validation to ensure the move has a valid piece and
+     * the source and destination are different. Coordinates are always on
+     * the board by construction.
+     *
      * @return true if the move passes basic validation, false otherwise
      */
-    bool is_valid() const {
-        return from_rank >= 0 && from_rank < 8 && from_file >= 0 && from_file < 8 &&
-               to_rank >= 0 && to_rank < 8 && to_file >= 0 && to_file < 8 &&
-               piece != '.' && !(from_rank == to_rank && from_file == to_file);
+    constexpr bool is_valid() const {
+        return piece_code() != NO_PIECE && from_square() != to_square();
     }
 
     /**
      * @brief Check if this move captures a piece
-     * 
+     *
      * @return true if this move captures an opponent's piece, false otherwise
      */
-    bool is_capture() const {
-        return captured_piece != '.';
+    constexpr bool is_capture() const {
+        return captured_code() != NO_PIECE;
     }
 
     /**
      * @brief Check if this move is a pawn promotion
-     * 
+     *
      * @return true if this move promotes a pawn, false otherwise
      */
-    bool is_promotion() const {
-        return promotion_piece != '.';
+    constexpr bool is_promotion() const {
+        return promotion_code() != NO_PIECE;
     }
 
     /**
      * @brief Print the move to standard output
-     * 
+     *
      * Prints the move in algebraic notation to the console.
      */
     void print() const {
@@ -136,27 +282,112 @@ struct Move {
 
     /**
      * @brief Equality comparison operator
-     * 
-     * Compares all fields of two moves to determine if they are identical.
-     * 
+     *
+     * Two moves are identical when their packed representations match.
+     *
      * @param other The move to compare with
      * @return true if all fields match, false otherwise
      */
-    bool operator==(const Move& other) const {
-        return from_rank == other.from_rank && from_file == other.from_file &&
-               to_rank == other.to_rank && to_file == other.to_file &&
-               piece == other.piece && captured_piece == other.captured_piece &&
-               promotion_piece == other.promotion_piece && is_castling == other.is_castling &&
-               is_en_passant == other.is_en_passant;
+    constexpr bool operator==(const Move& other) const {
+        return data == other.data;
     }
+
+    constexpr bool operator!=(const Move& other) const {
+        return data != other.data;
+    }
+
+private:
+    uint32_t data;
 };
 
+static_assert(sizeof(Move) == 4, "Move must stay packed into 32 bits");
+
 /**
- * @brief Type alias for a list of moves
- * 
- * Convenient alias for std::vector<Move> used throughout the codebase
- * to represent collections of chess moves.
+ * @brief Fixed-capacity, stack-resident list of moves
+ *
+ * Replaces std::vector<Move> on every move generation path so that search
+ * never touches the heap. 256 entries is more than the maximum number of
+ * legal moves in any reachable chess position (218). The storage is left
+ * uninitialised, so constructing a list costs nothing beyond the counter.
  */
-using MoveList = std::vector<Move>;
+class MoveList {
+public:
+    static constexpr size_t MAX_MOVES = 256;
+
+    using value_type = Move;
+    using iterator = Move*;
+    using const_iterator = const Move*;
+
+    MoveList() : count(0) {}
+
+    MoveList(const MoveList& other) : count(other.count) {
+        std::copy(other.begin(), other.end(), moves);
+    }
+
+    MoveList& operator=(const MoveList& other) {
+        count = other.count;
+        std::copy(other.begin(), other.end(), moves);
+        return *this;
+    }
+
+    /**
+     * @brief Append a move (capacity is not checked in release builds)
+     */
+    void push_back(const Move& move) {
+        assert(count < MAX_MOVES);
+        moves[count++] = move;
+    }
+
+    void pop_back() { --count; }
+    void clear() { count = 0; }
+
+    /**
+     * @brief Shrink the list to the given size (never grows it)
+     */
+    void resize(size_t new_size) {
+        assert(new_size <= count);
+        count = new_size;
+    }
+
+    /**
+     * @brief Remove the range [first, last) by shifting the tail down
+     */
+    iterator erase(iterator first, iterator last) {
+        iterator new_end = std::move(last, end(), first);
+        count = static_cast<size_t>(new_end - moves);
+        return first;
+    }
+
+    /**
+     * @brief Check whether the list contains the given move
+     */
+    bool contains(const Move& move) const {
+        return std::find(begin(), end(), move) != end();
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    static constexpr size_t capacity() { return MAX_MOVES; }
+
+    Move& operator[](size_t index) { return moves[index]; }
+    const Move& operator[](size_t index) const { return moves[index]; }
+    Move& front() { return moves[0]; }
+    const Move& front() const { return moves[0]; }
+    Move& back() { return moves[count - 1]; }
+    const Move& back() const { return moves[count - 1]; }
+
+    iterator begin() { return moves; }
+    iterator end() { return moves + count; }
+    const_iterator begin() const { return moves; }
+    const_iterator end() const { return moves + count; }
+    Move* data() { return moves; }
+    const Move* data() const { return moves; }
+
+private:
+    size_t count;
+    union {
+        Move moves[MAX_MOVES];
+    };
+};
 
-#endif // MOVE_H
\ No newline at end of file
+#endif // MOVE_H
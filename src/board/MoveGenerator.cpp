@@ -5,7 +5,6 @@
 
 // TODO: Fix optimization similar to this one all around
 // TODO: Replace push_back with emplace_back in possible cases
-// TODO: Use std::array instead of std::vector where is possible
 // TODO: Identify why the prefetching is not working as expected (less computations per second)
 // Cache optimization macros
 #ifdef _MSC_VER
@@ -54,9 +53,8 @@ MoveGenerator::MoveGenerator() : nodes_searched(0), moves_generated(0) {
     BitboardUtils::init();
 }
 
-std::vector<Move> MoveGenerator::generate_all_moves(const Board& board) {
-    std::vector<Move> moves;
-    moves.reserve(218); // More precise reservation based on average move count
+MoveList MoveGenerator::generate_all_moves(const Board& board) {
+    MoveList moves;
 
     // Prefetch critical board data for better cache performance
     Board::Color color = board.get_active_color();
@@ -101,54 +99,63 @@ std::vector<Move> MoveGenerator::generate_all_moves(const Board& board) {
     return moves;
 }
 
-std::vector<Move> MoveGenerator::generate_legal_moves(Board& board) {
-    std::vector<Move> pseudo_legal = generate_all_moves(board);
-    std::vector<Move> legal_moves;
-    legal_moves.reserve(pseudo_legal.size());
+MoveList MoveGenerator::generate_legal_moves(Board& board) {
+    MoveList legal_moves = generate_legal_moves_unordered(board);
 
-    // Pre-compute check and pin information for faster legality testing
+    // Order moves for better search performance
+    // TODO: (Refactor) Check the existing ordering algorithm.
+    order_moves(legal_moves, board);
+    return legal_moves;
+}
+
+MoveList MoveGenerator::generate_legal_moves_unordered(const Board& board) {
+    MoveList legal_moves;
+
+    // Pre-compute check and pin information
     Board::Color color = board.get_active_color();
-    
-    // Prefetch king position and attack tables for legality checking
-    int king_square = board.get_king_position(color);
-    if (king_square != -1) {
-        // Prefetch attack tables around king position for pin detection
-        // PREFETCH_READ(BitboardUtils::get_rook_attacks_table(king_square));
-        // PREFETCH_READ(BitboardUtils::get_bishop_attacks_table(king_square));
-    }
-    
-    Bitboard pinned_pieces = get_pinned_pieces(board, color);
-    Bitboard check_mask = get_check_mask(board, color);
-    bool in_check = (check_mask != FULL_BOARD);
-    
-    // Prefetch move data for faster iteration
-    if (!pseudo_legal.empty()) {
-        // PREFETCH_RANGE(pseudo_legal.data(), pseudo_legal.size() * sizeof(Move));
+    bool in_check = board.is_in_check(color);
+
+    if (!in_check) {
+        // Every move is legal by construction, nothing is played to be filtered
+        generate_legal_piece_moves(board, legal_moves, FULL_BOARD, get_pinned_pieces(board, color));
+        generate_legal_king_moves(board, legal_moves);
+        generate_castling_moves(board, legal_moves);
+        moves_generated += legal_moves.size();
+    } else {
+        legal_moves = generate_evasions(board);
     }
+    return legal_moves;
+}
 
-    for (const Move& move : pseudo_legal) {
-        // Fast legality check using precomputed masks
-        if (in_check) {
-            if (is_move_legal_in_check(board, move, check_mask, pinned_pieces)) {
-                legal_moves.push_back(move);
-            }
-        } else {
-            if (is_legal_move(board, move)) {
-                legal_moves.push_back(move);
-            }
-        }
+MoveList MoveGenerator::generate_evasions(const Board& board) {
+    MoveList moves;
+
+    Board::Color color = board.get_active_color();
+
+    // The king may always try to step out of check
+    generate_legal_king_moves(board, moves);
+
+    // Against a single checker the other pieces may capture it or interpose;
+    // in double check the mask is empty and only king moves remain
+    Bitboard check_mask = get_check_mask(board, color);
+    if (check_mask) {
+        generate_legal_piece_moves(board, moves, check_mask, get_pinned_pieces(board, color));
     }
 
-    // Order moves for better search performance
-    // TODO: (Refactor) Check the existing ordering algorithm.
-    order_moves(legal_moves, board);
-    return legal_moves;
+    moves_generated += moves.size();
+    return moves;
 }
 
-std::vector<Move> MoveGenerator::generate_captures(const Board& board) {
-    std::vector<Move> moves;
-    moves.reserve(32); // More precise reservation for captures
+MoveList MoveGenerator::generate_captures(const Board& board) {
+    MoveList moves;
+    generate_captures(board, moves);
 
+    // Order captures by MVV-LVA
+    order_captures(moves, board);
+    return moves;
+}
+
+void MoveGenerator::generate_captures(const Board& board, MoveList& moves) {
     // Generate captures in MVV-LVA order for better performance
     generate_queen_moves(board, moves, true);   // Queen captures first
     generate_rook_moves(board, moves, true);
@@ -157,15 +164,32 @@ std::vector<Move> MoveGenerator::generate_captures(const Board& board) {
     generate_pawn_moves(board, moves, true);    // Includes promotions
     generate_king_moves(board, moves, true);
     generate_en_passant_moves(board, moves);
+}
 
-    // Order captures by MVV-LVA
-    order_captures(moves, board);
+void MoveGenerator::generate_promotions(const Board& board, MoveList& moves) {
+    Board::Color color = board.get_active_color();
+    Bitboard empty_squares = ~board.get_all_pieces();
+
+    // Only pawns one step from the last rank can promote by pushing
+    Bitboard pawns = board.get_piece_bitboard(Board::PAWN, color) &
+                     (color == Board::WHITE ? RANK_7 : RANK_2);
+    while (pawns) {
+        int from_square = BitboardUtils::pop_lsb(pawns);
+        int to_square = from_square + (color == Board::WHITE ? 8 : -8);
+        if (BitboardUtils::get_bit(empty_squares, to_square)) {
+            add_promotion_moves(from_square, to_square, color, board, moves, false);
+        }
+    }
+}
+
+MoveList MoveGenerator::generate_quiet_moves(const Board& board) {
+    MoveList moves;
+    generate_quiet_moves(board, moves);
     return moves;
 }
 
-std::vector<Move> MoveGenerator::generate_quiet_moves(const Board& board) {
-    std::vector<Move> moves;
-    moves.reserve(186); // More precise reservation for quiet moves
+void MoveGenerator::generate_quiet_moves(const Board& board, MoveList& moves) {
+    size_t first_quiet = moves.size();
 
     // Generate quiet moves (non-captures)
     generate_queen_moves(board, moves, false);
@@ -181,17 +205,14 @@ std::vector<Move> MoveGenerator::generate_quiet_moves(const Board& board) {
                                    Board::BLACK : Board::WHITE;
     Bitboard opponent_pieces = board.get_color_bitboard(opponent);
 
-    // Use more efficient filtering with iterator
-    auto new_end = std::remove_if(moves.begin(), moves.end(), [&](const Move& move) {
-        int to_square = BitboardUtils::square_index(move.to_rank, move.to_file);
-        return BitboardUtils::get_bit(opponent_pieces, to_square);
+    // Use more efficient filtering with iterator, leaving earlier entries untouched
+    auto new_end = std::remove_if(moves.begin() + first_quiet, moves.end(), [&](const Move& move) {
+        return BitboardUtils::get_bit(opponent_pieces, move.to_square());
     });
     moves.erase(new_end, moves.end());
-
-    return moves;
 }
 
-void MoveGenerator::generate_pawn_moves(const Board& board, std::vector<Move>& moves, bool captures_only) {
+void MoveGenerator::generate_pawn_moves(const Board& board, MoveList& moves, bool captures_only) {
     Board::Color color = board.get_active_color();
     Board::Color opponent = (color == Board::WHITE) ? Board::BLACK : Board::WHITE;
 
@@ -251,10 +272,10 @@ void MoveGenerator::generate_pawn_moves(const Board& board, std::vector<Move>& m
  * Knights move in an L-shape (2+1 squares).
  * 
  * @param board The current board position
- * @param moves Vector to append generated moves to
+ * @param moves Move list to append generated moves to
  * @param captures_only If true, only generate capture moves
  */
-void MoveGenerator::generate_knight_moves(const Board& board, std::vector<Move>& moves, bool captures_only) {
+void MoveGenerator::generate_knight_moves(const Board& board, MoveList& moves, bool captures_only) {
     Board::Color color = board.get_active_color();
     Bitboard knights = board.get_piece_bitboard(Board::KNIGHT, color);
     Bitboard own_pieces = board.get_color_bitboard(color);
@@ -290,10 +311,10 @@ void MoveGenerator::generate_knight_moves(const Board& board, std::vector<Move>&
  * sliding piece attack calculation.
  * 
  * @param board The current board position
- * @param moves Vector to append generated moves to
+ * @param moves Move list to append generated moves to
  * @param captures_only If true, only generate capture moves
  */
-void MoveGenerator::generate_bishop_moves(const Board& board, std::vector<Move>& moves, bool captures_only) {
+void MoveGenerator::generate_bishop_moves(const Board& board, MoveList& moves, bool captures_only) {
     Board::Color color = board.get_active_color();
     Bitboard bishops = board.get_piece_bitboard(Board::BISHOP, color);
     Bitboard own_pieces = board.get_color_bitboard(color);
@@ -332,7 +353,7 @@ void MoveGenerator::generate_bishop_moves(const Board& board, std::vector<Move>&
     }
 }
 
-void MoveGenerator::generate_rook_moves(const Board& board, std::vector<Move>& moves, bool captures_only) {
+void MoveGenerator::generate_rook_moves(const Board& board, MoveList& moves, bool captures_only) {
     Board::Color color = board.get_active_color();
     Bitboard rooks = board.get_piece_bitboard(Board::ROOK, color);
     Bitboard own_pieces = board.get_color_bitboard(color);
@@ -371,7 +392,7 @@ void MoveGenerator::generate_rook_moves(const Board& board, std::vector<Move>& m
     }
 }
 
-void MoveGenerator::generate_queen_moves(const Board& board, std::vector<Move>& moves, bool captures_only) {
+void MoveGenerator::generate_queen_moves(const Board& board, MoveList& moves, bool captures_only) {
     Board::Color color = board.get_active_color();
     Bitboard queens = board.get_piece_bitboard(Board::QUEEN, color);
     Bitboard own_pieces = board.get_color_bitboard(color);
@@ -412,7 +433,7 @@ void MoveGenerator::generate_queen_moves(const Board& board, std::vector<Move>&
     }
 }
 
-void MoveGenerator::generate_king_moves(const Board& board, std::vector<Move>& moves, bool captures_only) {
+void MoveGenerator::generate_king_moves(const Board& board, MoveList& moves, bool captures_only) {
     Board::Color color = board.get_active_color();
     int king_square = board.get_king_position(color);
 
@@ -435,39 +456,22 @@ void MoveGenerator::generate_king_moves(const Board& board, std::vector<Move>& m
                            Board::KING, color, board, moves, captures_only);
 }
 
-void MoveGenerator::generate_castling_moves(const Board& board, std::vector<Move>& moves) {
+void MoveGenerator::generate_castling_moves(const Board& board, MoveList& moves) {
     Board::Color color = board.get_active_color();
 
     if (is_in_check(board, color)) return;
 
+    int king_square = board.get_king_position(color);
+    uint8_t king_code = Move::make_piece_code(Board::KING, color);
+
     if (can_castle_kingside(board, color)) {
-        int king_rank = (color == Board::WHITE) ? 0 : 7;
-        Move castle_move;
-        castle_move.from_rank = king_rank;
-        castle_move.from_file = 4;
-        castle_move.to_rank = king_rank;
-        castle_move.to_file = 6;
-        castle_move.piece = piece_type_to_char(Board::KING, color);
-        castle_move.is_castling = true;
-        castle_move.promotion_piece = '.';
-        castle_move.is_en_passant = false;
-        castle_move.captured_piece = '.';  // Castling doesn't capture
-        moves.push_back(castle_move);
+        moves.push_back(Move::make(king_square, king_square + 2, king_code,
+                                   Move::NO_PIECE, Move::NO_PIECE, Move::CASTLING_FLAG));
     }
 
     if (can_castle_queenside(board, color)) {
-        int king_rank = (color == Board::WHITE) ? 0 : 7;
-        Move castle_move;
-        castle_move.from_rank = king_rank;
-        castle_move.from_file = 4;
-        castle_move.to_rank = king_rank;
-        castle_move.to_file = 2;
-        castle_move.piece = piece_type_to_char(Board::KING, color);
-        castle_move.is_castling = true;
-        castle_move.promotion_piece = '.';
-        castle_move.is_en_passant = false;
-        castle_move.captured_piece = '.';  // Castling doesn't capture
-        moves.push_back(castle_move);
+        moves.push_back(Move::make(king_square, king_square - 2, king_code,
+                                   Move::NO_PIECE, Move::NO_PIECE, Move::CASTLING_FLAG));
     }
 }
 
@@ -478,9 +482,9 @@ void MoveGenerator::generate_castling_moves(const Board& board, std::vector<Move
  * two squares and is adjacent to one of our pawns.
  * 
  * @param board The current board position
- * @param moves Vector to append generated moves to
+ * @param moves Move list to append generated moves to
  */
-void MoveGenerator::generate_en_passant_moves(const Board& board, std::vector<Move>& moves) {
+void MoveGenerator::generate_en_passant_moves(const Board& board, MoveList& moves) {
     if (board.get_en_passant_file() == -1) return;
 
     Board::Color color = board.get_active_color();
@@ -489,47 +493,126 @@ void MoveGenerator::generate_en_passant_moves(const Board& board, std::vector<Mo
     int en_passant_file = board.get_en_passant_file();
     int en_passant_rank = (color == Board::WHITE) ? 5 : 2;
     int capture_rank = (color == Board::WHITE) ? 4 : 3;
+    int target_square = BitboardUtils::square_index(en_passant_rank, en_passant_file);
+
+    Board::Color opponent = (color == Board::WHITE) ? Board::BLACK : Board::WHITE;
+    uint8_t pawn_code = Move::make_piece_code(Board::PAWN, color);
+    uint8_t captured_code = Move::make_piece_code(Board::PAWN, opponent);
 
     // Check for pawns that can capture en passant
     if (en_passant_file > 0) {
         int left_pawn_square = BitboardUtils::square_index(capture_rank, en_passant_file - 1);
         if (BitboardUtils::get_bit(pawns, left_pawn_square)) {
-            Move en_passant_move;
-            en_passant_move.from_rank = capture_rank;
-            en_passant_move.from_file = en_passant_file - 1;
-            en_passant_move.to_rank = en_passant_rank;
-            en_passant_move.to_file = en_passant_file;
-            en_passant_move.piece = piece_type_to_char(Board::PAWN, color);
-            en_passant_move.is_en_passant = true;
-            en_passant_move.is_castling = false;
-            en_passant_move.promotion_piece = '.';
-            // Set captured piece for en passant (opponent's pawn)
-            Board::Color opponent = (color == Board::WHITE) ? Board::BLACK : Board::WHITE;
-            en_passant_move.captured_piece = piece_type_to_char(Board::PAWN, opponent);
-            moves.push_back(en_passant_move);
+            moves.push_back(Move::make(left_pawn_square, target_square, pawn_code,
+                                       captured_code, Move::NO_PIECE, Move::EN_PASSANT_FLAG));
         }
     }
 
     if (en_passant_file < 7) {
         int right_pawn_square = BitboardUtils::square_index(capture_rank, en_passant_file + 1);
         if (BitboardUtils::get_bit(pawns, right_pawn_square)) {
-            Move en_passant_move;
-            en_passant_move.from_rank = capture_rank;
-            en_passant_move.from_file = en_passant_file + 1;
-            en_passant_move.to_rank = en_passant_rank;
-            en_passant_move.to_file = en_passant_file;
-            en_passant_move.piece = piece_type_to_char(Board::PAWN, color);
-            en_passant_move.is_en_passant = true;
-            en_passant_move.is_castling = false;
-            en_passant_move.promotion_piece = '.';
-            // Set captured piece for en passant (opponent's pawn)
-            Board::Color opponent = (color == Board::WHITE) ? Board::BLACK : Board::WHITE;
-            en_passant_move.captured_piece = piece_type_to_char(Board::PAWN, opponent);
-            moves.push_back(en_passant_move);
+            moves.push_back(Move::make(right_pawn_square, target_square, pawn_code,
+                                       captured_code, Move::NO_PIECE, Move::EN_PASSANT_FLAG));
         }
     }
 }
 
+void MoveGenerator::generate_legal_piece_moves(const Board& board, MoveList& moves,
+                                               Bitboard target_mask, Bitboard pinned_pieces) {
+    Board::Color color = board.get_active_color();
+    Board::Color opponent = (color == Board::WHITE) ? Board::BLACK : Board::WHITE;
+    int king_square = board.get_king_position(color);
+
+    Bitboard own_pieces = board.get_color_bitboard(color);
+    Bitboard opponent_pieces = board.get_color_bitboard(opponent);
+    Bitboard all_pieces = board.get_all_pieces();
+    Bitboard targets = target_mask & ~own_pieces;
+
+    // Pawns
+    Bitboard pawns = board.get_piece_bitboard(Board::PAWN, color);
+    int forward = (color == Board::WHITE) ? 8 : -8;
+    int start_rank = (color == Board::WHITE) ? 1 : 6;
+    while (pawns) {
+        int from_square = BitboardUtils::pop_lsb(pawns);
+        Bitboard allowed = targets;
+        if (BitboardUtils::get_bit(pinned_pieces, from_square)) {
+            allowed &= BitboardUtils::line_through(king_square, from_square);
+        }
+
+        Bitboard captures = BitboardUtils::pawn_attacks(from_square, color == Board::WHITE) & opponent_pieces & allowed;
+        add_pawn_moves(from_square, captures, color, board, moves, true);
+
+        int push_square = from_square + forward;
+        if (!BitboardUtils::get_bit(all_pieces, push_square)) {
+            add_pawn_moves(from_square, (1ULL << push_square) & allowed, color, board, moves, false);
+
+            int double_push_square = push_square + forward;
+            if (BitboardUtils::get_rank(from_square) == start_rank &&
+                !BitboardUtils::get_bit(all_pieces, double_push_square)) {
+                add_pawn_moves(from_square, (1ULL << double_push_square) & allowed, color, board, moves, false);
+            }
+        }
+    }
+
+    // Knights (a pinned knight can never stay on its pin ray)
+    Bitboard knights = board.get_piece_bitboard(Board::KNIGHT, color) & ~pinned_pieces;
+    while (knights) {
+        int from_square = BitboardUtils::pop_lsb(knights);
+        add_moves_from_bitboard(1ULL << from_square, BitboardUtils::knight_attacks(from_square) & targets,
+                                Board::KNIGHT, color, board, moves, false);
+    }
+
+    // Sliders
+    static constexpr Board::PieceType sliders[] = {Board::BISHOP, Board::ROOK, Board::QUEEN};
+    for (Board::PieceType piece_type : sliders) {
+        Bitboard pieces = board.get_piece_bitboard(piece_type, color);
+        while (pieces) {
+            int from_square = BitboardUtils::pop_lsb(pieces);
+            Bitboard attacks = (piece_type == Board::BISHOP) ? BitboardUtils::bishop_attacks(from_square, all_pieces)
+                             : (piece_type == Board::ROOK)   ? BitboardUtils::rook_attacks(from_square, all_pieces)
+                                                             : BitboardUtils::queen_attacks(from_square, all_pieces);
+            attacks &= targets;
+            if (BitboardUtils::get_bit(pinned_pieces, from_square)) {
+                attacks &= BitboardUtils::line_through(king_square, from_square);
+            }
+            add_moves_from_bitboard(1ULL << from_square, attacks, piece_type, color, board, moves, false);
+        }
+    }
+
+    // En passant removes two pieces from one rank, which pin masks cannot
+    // describe, so the rare candidates get the full single-move check
+    size_t en_passant_start = moves.size();
+    generate_en_passant_moves(board, moves);
+    size_t legal_count = en_passant_start;
+    for (size_t i = en_passant_start; i < moves.size(); ++i) {
+        if (board.is_move_legal(moves[i])) {
+            moves[legal_count++] = moves[i];
+        }
+    }
+    moves.resize(legal_count);
+}
+
+void MoveGenerator::generate_legal_king_moves(const Board& board, MoveList& moves) {
+    Board::Color color = board.get_active_color();
+    Board::Color opponent = (color == Board::WHITE) ? Board::BLACK : Board::WHITE;
+    int king_square = board.get_king_position(color);
+
+    if (king_square == -1) return;
+
+    // Remove the king so squares behind it on a checking ray count as attacked
+    Bitboard occupancy = board.get_all_pieces() & ~(1ULL << king_square);
+    Bitboard targets = BitboardUtils::king_attacks(king_square) & ~board.get_color_bitboard(color);
+    Bitboard safe_targets = 0;
+    while (targets) {
+        int to_square = BitboardUtils::pop_lsb(targets);
+        if (!board.is_square_attacked(to_square, opponent, occupancy)) {
+            BitboardUtils::set_bit(safe_targets, to_square);
+        }
+    }
+
+    add_moves_from_bitboard(1ULL << king_square, safe_targets, Board::KING, color, board, moves, false);
+}
+
 bool MoveGenerator::is_in_check(const Board& board, Board::Color color) {
     return board.is_in_check(color);
 }
@@ -627,109 +710,61 @@ int MoveGenerator::count_moves(const Board& board) {
 }
 
 bool MoveGenerator::has_legal_moves(Board& board) {
-    std::vector<Move> moves = generate_all_moves(board);
-    for (const Move& move : moves) {
-        if (is_legal_move(board, move)) {
-            return true;
-        }
-    }
-    return false;
+    return !generate_legal_moves(board).empty();
 }
 
 // Helper function implementations
 void MoveGenerator::add_moves_from_bitboard(Bitboard from_square, Bitboard to_squares,
                                                    Board::PieceType piece_type, Board::Color color,
-                                                   const Board& board, std::vector<Move>& moves, bool captures_only) {
+                                                   const Board& board, MoveList& moves, bool captures_only) {
     int from_sq = BitboardUtils::get_lsb_index(from_square);
-    int from_rank = BitboardUtils::get_rank(from_sq);
-    int from_file = BitboardUtils::get_file(from_sq);
+    uint8_t piece_code = Move::make_piece_code(piece_type, color);
 
     while (to_squares) {
         int to_sq = BitboardUtils::pop_lsb(to_squares);
-        int to_rank = BitboardUtils::get_rank(to_sq);
-        int to_file = BitboardUtils::get_file(to_sq);
-
-        Move move;
-        move.from_rank = from_rank;
-        move.from_file = from_file;
-        move.to_rank = to_rank;
-        move.to_file = to_file;
-        move.piece = piece_type_to_char(piece_type, color);
-        move.is_castling = false;
-        move.is_en_passant = false;
-        move.promotion_piece = '.';
-        
+
         // Set captured piece if there's a piece on the destination square
-        char piece_at_destination = board.get_piece(to_rank, to_file);
-        move.captured_piece = (piece_at_destination != '.') ? piece_at_destination : '.';
+        uint8_t captured_code = Move::char_to_code(board.get_piece(to_sq >> 3, to_sq & 7));
 
-        moves.push_back(move);
+        moves.push_back(Move::make(from_sq, to_sq, piece_code, captured_code));
     }
 }
 
 void MoveGenerator::add_pawn_moves(int from_square, Bitboard to_squares, Board::Color color,
-                                          const Board& board, std::vector<Move>& moves, bool is_capture) {
-    int from_rank = BitboardUtils::get_rank(from_square);
-    int from_file = BitboardUtils::get_file(from_square);
+                                          const Board& board, MoveList& moves, bool is_capture) {
+    uint8_t pawn_code = Move::make_piece_code(Board::PAWN, color);
 
     while (to_squares) {
         int to_square = BitboardUtils::pop_lsb(to_squares);
         int to_rank = BitboardUtils::get_rank(to_square);
-        int to_file = BitboardUtils::get_file(to_square);
 
         if (is_promotion_rank(to_rank, color)) {
             add_promotion_moves(from_square, to_square, color, board, moves, is_capture);
         } else {
-            Move move;
-            move.from_rank = from_rank;
-            move.from_file = from_file;
-            move.to_rank = to_rank;
-            move.to_file = to_file;
-            move.piece = piece_type_to_char(Board::PAWN, color);
-            move.is_castling = false;
-            move.is_en_passant = false;
-            move.promotion_piece = '.';
-            
             // Set captured piece for captures
-            if (is_capture) {
-                move.captured_piece = board.get_piece(to_rank, to_file);
-            } else {
-                move.captured_piece = '.';
-            }
+            uint8_t captured_code = is_capture
+                ? Move::char_to_code(board.get_piece(to_rank, to_square & 7))
+                : Move::NO_PIECE;
 
-            moves.push_back(move);
+            moves.push_back(Move::make(from_square, to_square, pawn_code, captured_code));
         }
     }
 }
 
 void MoveGenerator::add_promotion_moves(int from_square, int to_square, Board::Color color,
-                                               const Board& board, std::vector<Move>& moves, bool is_capture) {
-    int from_rank = BitboardUtils::get_rank(from_square);
-    int from_file = BitboardUtils::get_file(from_square);
-    int to_rank = BitboardUtils::get_rank(to_square);
-    int to_file = BitboardUtils::get_file(to_square);
-
-    char promotion_pieces[] = {'q', 'r', 'b', 'n'};
-
-    for (char promo_piece : promotion_pieces) {
-        Move move;
-        move.from_rank = from_rank;
-        move.from_file = from_file;
-        move.to_rank = to_rank;
-        move.to_file = to_file;
-        move.piece = piece_type_to_char(Board::PAWN, color);
-        move.promotion_piece = (color == Board::WHITE) ? std::toupper(promo_piece) : promo_piece;
-        move.is_castling = false;
-        move.is_en_passant = false;
-        
-        // Set captured piece for promotion captures
-        if (is_capture) {
-            move.captured_piece = board.get_piece(to_rank, to_file);
-        } else {
-            move.captured_piece = '.';
-        }
+                                               const Board& board, MoveList& moves, bool is_capture) {
+    static constexpr Board::PieceType promotion_pieces[] = {Board::QUEEN, Board::ROOK, Board::BISHOP, Board::KNIGHT};
+
+    uint8_t pawn_code = Move::make_piece_code(Board::PAWN, color);
+
+    // Set captured piece for promotion captures
+    uint8_t captured_code = is_capture
+        ? Move::char_to_code(board.get_piece(to_square >> 3, to_square & 7))
+        : Move::NO_PIECE;
 
-        moves.push_back(move);
+    for (Board::PieceType promo_piece : promotion_pieces) {
+        moves.push_back(Move::make(from_square, to_square, pawn_code, captured_code,
+                                   Move::make_piece_code(promo_piece, color)));
     }
 }
 
@@ -805,7 +840,7 @@ bool MoveGenerator::is_promotion_rank(int rank, Board::Color color) {
 }
 
 // Move ordering implementation
-void MoveGenerator::order_moves(std::vector<Move>& moves, const Board& board) {
+void MoveGenerator::order_moves(MoveList& moves, const Board& board) {
     std::sort(moves.begin(), moves.end(), [&](const Move& a, const Move& b) {
         return get_move_score(a, board) > get_move_score(b, board);
     });
@@ -817,10 +852,10 @@ void MoveGenerator::order_moves(std::vector<Move>& moves, const Board& board) {
  * Sorts capture moves using Most Valuable Victim - Least Valuable
  * Attacker heuristic for optimal search ordering.
  * 
- * @param moves Vector of capture moves to order (modified in place)
+ * @param moves List of capture moves to order (modified in place)
  * @param board The current board position for move evaluation
  */
-void MoveGenerator::order_captures(std::vector<Move>& moves, const Board& board) {
+void MoveGenerator::order_captures(MoveList& moves, const Board& board) {
     std::sort(moves.begin(), moves.end(), [&](const Move& a, const Move& b) {
         return get_capture_score(a, board) > get_capture_score(b, board);
     });
@@ -840,24 +875,25 @@ int MoveGenerator::get_move_score(const Move& move, const Board& board) {
     int score = 0;
     
     // Promotion bonus
-    if (move.promotion_piece != '.') {
+    if (move.is_promotion()) {
         score += PROMOTION_BONUS;
-        if (move.promotion_piece == 'Q' || move.promotion_piece == 'q') score += 400;
-        else if (move.promotion_piece == 'R' || move.promotion_piece == 'r') score += 200;
-        else if (move.promotion_piece == 'B' || move.promotion_piece == 'b') score += 100;
-        else if (move.promotion_piece == 'N' || move.promotion_piece == 'n') score += 100;
+        switch (move.promotion_type()) {
+            case Board::QUEEN: score += 400; break;
+            case Board::ROOK: score += 200; break;
+            case Board::BISHOP: score += 100; break;
+            case Board::KNIGHT: score += 100; break;
+            default: break;
+        }
     }
     
     // Capture bonus (MVV-LVA)
-    if (move.captured_piece != '.') {
-        int victim = char_to_piece_type(move.captured_piece);
-        int attacker = char_to_piece_type(move.piece);
-        score += MVV_LVA[attacker][victim];
+    if (move.is_capture()) {
+        score += MVV_LVA[move.piece_type() + 1][move.captured_type() + 1];
     }
     
     // Special move bonuses
-    if (move.is_castling) score += CASTLING_BONUS;
-    if (move.is_en_passant) score += EN_PASSANT_BONUS;
+    if (move.is_castling()) score += CASTLING_BONUS;
+    if (move.is_en_passant()) score += EN_PASSANT_BONUS;
     
     return score;
 }
@@ -873,11 +909,9 @@ int MoveGenerator::get_move_score(const Move& move, const Board& board) {
  * @return MVV-LVA score for the capture
  */
 int MoveGenerator::get_capture_score(const Move& move, const Board& board) {
-    if (move.captured_piece == '.') return 0;
+    if (!move.is_capture()) return 0;
     
-    int victim = char_to_piece_type(move.captured_piece);
-    int attacker = char_to_piece_type(move.piece);
-    return MVV_LVA[attacker][victim];
+    return MVV_LVA[move.piece_type() + 1][move.captured_type() + 1];
 }
 
 int MoveGenerator::char_to_piece_type(char piece) {
@@ -908,25 +942,29 @@ Bitboard MoveGenerator::get_pinned_pieces(const Board& board, Board::Color color
     Bitboard enemy_bishops_queens = board.get_piece_bitboard(Board::BISHOP, opponent) |
                                    board.get_piece_bitboard(Board::QUEEN, opponent);
     
+    // Look through our own pieces from the king: a slider seen this way with
+    // exactly one of our pieces in between pins that piece
+    Bitboard xray_occupancy = board.get_color_bitboard(opponent);
+
     // Rook/Queen pins (horizontal and vertical)
-    Bitboard rook_attacks = BitboardUtils::rook_attacks(king_square, all_pieces);
+    Bitboard rook_attacks = BitboardUtils::rook_attacks(king_square, xray_occupancy);
     Bitboard potential_pinners = rook_attacks & enemy_rooks_queens;
     
     while (potential_pinners) {
         int pinner_square = BitboardUtils::pop_lsb(potential_pinners);
-        Bitboard between = get_between_squares(king_square, pinner_square) & all_pieces;
+        Bitboard between = BitboardUtils::between_squares(king_square, pinner_square) & all_pieces;
         if (BitboardUtils::popcount(between) == 1 && (between & own_pieces)) {
             pinned |= between;
         }
     }
     
     // Bishop/Queen pins (diagonal)
-    Bitboard bishop_attacks = BitboardUtils::bishop_attacks(king_square, all_pieces);
+    Bitboard bishop_attacks = BitboardUtils::bishop_attacks(king_square, xray_occupancy);
     potential_pinners = bishop_attacks & enemy_bishops_queens;
     
     while (potential_pinners) {
         int pinner_square = BitboardUtils::pop_lsb(potential_pinners);
-        Bitboard between = get_between_squares(king_square, pinner_square) & all_pieces;
+        Bitboard between = BitboardUtils::between_squares(king_square, pinner_square) & all_pieces;
         if (BitboardUtils::popcount(between) == 1 && (between & own_pieces)) {
             pinned |= between;
         }
@@ -955,37 +993,18 @@ Bitboard MoveGenerator::get_check_mask(const Board& board, Board::Color color) {
     
     // Single check: can block or capture
     Bitboard mask = checkers; // Can capture the checker
-    mask |= get_between_squares(king_square, checker_square); // Can block
+    mask |= BitboardUtils::between_squares(king_square, checker_square); // Can block
     
     return mask;
 }
 
-Bitboard MoveGenerator::get_between_squares(int sq1, int sq2) {
-    Bitboard between = 0;
-    
-    int rank1 = BitboardUtils::get_rank(sq1);
-    int file1 = BitboardUtils::get_file(sq1);
-    int rank2 = BitboardUtils::get_rank(sq2);
-    int file2 = BitboardUtils::get_file(sq2);
-    
-    int rank_dir = (rank2 > rank1) ? 1 : (rank2 < rank1) ? -1 : 0;
-    int file_dir = (file2 > file1) ? 1 : (file2 < file1) ? -1 : 0;
-    
-    int rank = rank1 + rank_dir;
-    int file = file1 + file_dir;
-    
-    while (rank != rank2 || file != file2) {
-        BitboardUtils::set_bit(between, BitboardUtils::square_index(rank, file));
-        rank += rank_dir;
-        file += file_dir;
-    }
-    
-    return between;
+Bitboard MoveGenerator::get_attackers_to_square(const Board& board, int square, Board::Color attacking_color) {
+    return get_attackers_to_square(board, square, attacking_color, board.get_all_pieces());
 }
 
-Bitboard MoveGenerator::get_attackers_to_square(const Board& board, int square, Board::Color attacking_color) {
+Bitboard MoveGenerator::get_attackers_to_square(const Board& board, int square, Board::Color attacking_color,
+                                                Bitboard all_pieces) {
     Bitboard attackers = 0;
-    Bitboard all_pieces = board.get_all_pieces();
     
     // Pawn attacks
     Bitboard pawn_attacks = BitboardUtils::pawn_attacks(square, attacking_color != Board::WHITE);
@@ -1012,54 +1031,166 @@ Bitboard MoveGenerator::get_attackers_to_square(const Board& board, int square,
     return attackers;
 }
 
-bool MoveGenerator::is_move_legal_in_check(const Board& board, const Move& move, Bitboard check_mask, Bitboard pinned_pieces) {
-    int from_square = BitboardUtils::square_index(move.from_rank, move.from_file);
-    int to_square = BitboardUtils::square_index(move.to_rank, move.to_file);
+int MoveGenerator::see(const Board& board, const Move& move) {
+    if (move.is_castling()) {
+        return 0;
+    }
     
-    // King moves need special handling
-    if (move.piece == 'K' || move.piece == 'k') {
-        // King must move to a safe square
-        Board::Color color = (move.piece == 'K') ? Board::WHITE : Board::BLACK;
-        Board::Color opponent = (color == Board::WHITE) ? Board::BLACK : Board::WHITE;
-        return !is_square_attacked(board, to_square, opponent);
+    int from_square = move.from_square();
+    int to_square = move.to_square();
+    Board::Color side = static_cast<Board::Color>(move.piece_color());
+    
+    // gain[d] is the balance for the side making capture d if the exchange stops after it
+    int gain[32];
+    int d = 0;
+    gain[0] = move.is_capture() ? SEE_VALUES[move.captured_type()] : 0;
+    int next_victim = SEE_VALUES[move.piece_type()];
+    if (move.is_promotion()) {
+        gain[0] += SEE_VALUES[move.promotion_type()] - SEE_VALUES[Board::PAWN];
+        next_victim = SEE_VALUES[move.promotion_type()];
     }
     
-    // Non-king moves must either capture the checker or block the check
-    if (!(BitboardUtils::get_bit(check_mask, to_square))) {
-        return false;
+    Bitboard occupancy = board.get_all_pieces() ^ (1ULL << from_square);
+    if (move.is_en_passant()) {
+        occupancy ^= (1ULL << BitboardUtils::square_index(move.from_rank(), move.to_file()));
     }
     
-    // Check if the moving piece is pinned
-    if (BitboardUtils::get_bit(pinned_pieces, from_square)) {
-        // Pinned pieces can only move along the pin ray
-        int king_square = board.get_king_position(board.get_active_color());
-        return are_squares_aligned(king_square, from_square, to_square);
+    Bitboard diagonal_sliders = board.get_piece_bitboard(Board::BISHOP, Board::WHITE) |
+                                board.get_piece_bitboard(Board::BISHOP, Board::BLACK) |
+                                board.get_piece_bitboard(Board::QUEEN, Board::WHITE) |
+                                board.get_piece_bitboard(Board::QUEEN, Board::BLACK);
+    Bitboard straight_sliders = board.get_piece_bitboard(Board::ROOK, Board::WHITE) |
+                                board.get_piece_bitboard(Board::ROOK, Board::BLACK) |
+                                board.get_piece_bitboard(Board::QUEEN, Board::WHITE) |
+                                board.get_piece_bitboard(Board::QUEEN, Board::BLACK);
+    Bitboard attackers = (get_attackers_to_square(board, to_square, Board::WHITE, occupancy) |
+                          get_attackers_to_square(board, to_square, Board::BLACK, occupancy)) & occupancy;
+    
+    while (d < 31) {
+        side = (side == Board::WHITE) ? Board::BLACK : Board::WHITE;
+        Bitboard side_attackers = attackers & board.get_color_bitboard(side);
+        if (!side_attackers) {
+            break;
+        }
+        
+        // Least valuable attacker recaptures
+        int piece = Board::PAWN;
+        while (!(side_attackers & board.get_piece_bitboard(static_cast<Board::PieceType>(piece), side))) {
+            piece++;
+        }
+        Bitboard attacker = side_attackers & board.get_piece_bitboard(static_cast<Board::PieceType>(piece), side);
+        
+        // The king may only take when nothing recaptures
+        Board::Color opponent = (side == Board::WHITE) ? Board::BLACK : Board::WHITE;
+        if (piece == Board::KING && (attackers & board.get_color_bitboard(opponent))) {
+            break;
+        }
+        
+        d++;
+        gain[d] = next_victim - gain[d - 1];
+        next_victim = SEE_VALUES[piece];
+        
+        // Remove the attacker and let sliders behind it join in
+        occupancy ^= attacker & -attacker;
+        if (piece == Board::PAWN || piece == Board::BISHOP || piece == Board::QUEEN) {
+            attackers |= BitboardUtils::bishop_attacks(to_square, occupancy) & diagonal_sliders;
+        }
+        if (piece == Board::ROOK || piece == Board::QUEEN) {
+            attackers |= BitboardUtils::rook_attacks(to_square, occupancy) & straight_sliders;
+        }
+        attackers &= occupancy;
     }
     
-    return true;
+    // Each side stops the exchange as soon as continuing would cost material
+    while (d > 0) {
+        gain[d - 1] = -std::max(-gain[d - 1], gain[d]);
+        d--;
+    }
+    return gain[0];
 }
 
-bool MoveGenerator::are_squares_aligned(int sq1, int sq2, int sq3) {
-    int rank1 = BitboardUtils::get_rank(sq1);
-    int file1 = BitboardUtils::get_file(sq1);
-    int rank2 = BitboardUtils::get_rank(sq2);
-    int file2 = BitboardUtils::get_file(sq2);
-    int rank3 = BitboardUtils::get_rank(sq3);
-    int file3 = BitboardUtils::get_file(sq3);
+bool MoveGenerator::see_ge(const Board& board, const Move& move, int threshold) {
+    if (move.is_castling()) {
+        return threshold <= 0;
+    }
+    
+    int from_square = move.from_square();
+    int to_square = move.to_square();
+    Board::Color side = static_cast<Board::Color>(move.piece_color());
     
-    // Check if all three squares are on the same rank, file, or diagonal
-    if (rank1 == rank2 && rank2 == rank3) return true; // Same rank
-    if (file1 == file2 && file2 == file3) return true; // Same file
+    // swap is the margin by which the side to move in the exchange is ahead
+    // of the threshold if it stops now
+    int swap = (move.is_capture() ? SEE_VALUES[move.captured_type()] : 0) - threshold;
+    int next_victim = SEE_VALUES[move.piece_type()];
+    if (move.is_promotion()) {
+        swap += SEE_VALUES[move.promotion_type()] - SEE_VALUES[Board::PAWN];
+        next_victim = SEE_VALUES[move.promotion_type()];
+    }
+    if (swap < 0) {
+        return false;
+    }
+    
+    // Even losing the moving piece for nothing still reaches the threshold
+    swap = next_victim - swap;
+    if (swap <= 0) {
+        return true;
+    }
     
-    // Check diagonal alignment
-    int rank_diff1 = rank2 - rank1;
-    int file_diff1 = file2 - file1;
-    int rank_diff2 = rank3 - rank2;
-    int file_diff2 = file3 - file2;
+    Bitboard occupancy = board.get_all_pieces() ^ (1ULL << from_square);
+    if (move.is_en_passant()) {
+        occupancy ^= (1ULL << BitboardUtils::square_index(move.from_rank(), move.to_file()));
+    }
+    
+    Bitboard diagonal_sliders = board.get_piece_bitboard(Board::BISHOP, Board::WHITE) |
+                                board.get_piece_bitboard(Board::BISHOP, Board::BLACK) |
+                                board.get_piece_bitboard(Board::QUEEN, Board::WHITE) |
+                                board.get_piece_bitboard(Board::QUEEN, Board::BLACK);
+    Bitboard straight_sliders = board.get_piece_bitboard(Board::ROOK, Board::WHITE) |
+                                board.get_piece_bitboard(Board::ROOK, Board::BLACK) |
+                                board.get_piece_bitboard(Board::QUEEN, Board::WHITE) |
+                                board.get_piece_bitboard(Board::QUEEN, Board::BLACK);
+    Bitboard attackers = get_attackers_to_square(board, to_square, Board::WHITE, occupancy) |
+                         get_attackers_to_square(board, to_square, Board::BLACK, occupancy);
+    
+    // result is whether the moving side reaches the threshold if the side
+    // that just captured gets the last word
+    int result = 1;
+    while (true) {
+        side = (side == Board::WHITE) ? Board::BLACK : Board::WHITE;
+        attackers &= occupancy;
+        Bitboard side_attackers = attackers & board.get_color_bitboard(side);
+        if (!side_attackers) {
+            break;
+        }
+        result ^= 1;
+        
+        int piece = Board::PAWN;
+        while (!(side_attackers & board.get_piece_bitboard(static_cast<Board::PieceType>(piece), side))) {
+            piece++;
+        }
+        
+        // The king may only take when nothing recaptures
+        if (piece == Board::KING) {
+            return (attackers & ~board.get_color_bitboard(side)) ? !result : result;
+        }
+        
+        // Stop once the side to move cannot get back above the threshold
+        swap = SEE_VALUES[piece] - swap;
+        if (swap < result) {
+            break;
+        }
+        
+        Bitboard attacker = side_attackers & board.get_piece_bitboard(static_cast<Board::PieceType>(piece), side);
+        occupancy ^= attacker & -attacker;
+        if (piece == Board::PAWN || piece == Board::BISHOP || piece == Board::QUEEN) {
+            attackers |= BitboardUtils::bishop_attacks(to_square, occupancy) & diagonal_sliders;
+        }
+        if (piece == Board::ROOK || piece == Board::QUEEN) {
+            attackers |= BitboardUtils::rook_attacks(to_square, occupancy) & straight_sliders;
+        }
+    }
     
-    return (rank_diff1 * file_diff2 == rank_diff2 * file_diff1) && 
-           (std::abs(rank_diff1) == std::abs(file_diff1)) &&
-           (std::abs(rank_diff2) == std::abs(file_diff2));
+    return result;
 }
 
 Bitboard MoveGenerator::get_bishop_attacks(int square, Bitboard occupancy) {
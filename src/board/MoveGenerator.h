@@ -56,19 +56,42 @@ public:
      * for legality (moves that would leave the king in check).
      * 
      * @param board The current board position
-     * @return Vector containing all pseudo-legal moves
+     * @return Move list containing all pseudo-legal moves
      */
-    std::vector<Move> generate_all_moves(const Board& board);
+    MoveList generate_all_moves(const Board& board);
     /**
      * @brief Generate all legal moves for the current position
      * 
-     * Generates all legal moves for the active player, filtering out
-     * moves that would leave the king in check.
+     * Generates all legal moves for the active player. Outside of check the
+     * moves are legal by construction (pin rays and king safety masks), so
+     * no move has to be played and taken back to be filtered.
      * 
      * @param board The current board position (non-const for move testing)
-     * @return Vector containing all legal moves
+     * @return Move list containing all legal moves
      */
-    std::vector<Move> generate_legal_moves(Board& board);
+    MoveList generate_legal_moves(Board& board);
+    /**
+     * @brief Generate all legal moves without ordering them
+     * 
+     * Same moves as generate_legal_moves() in generation order, for callers
+     * that only count or walk the moves (perft) and would waste the sort.
+     * 
+     * @param board The current board position
+     * @return Move list containing all legal moves
+     */
+    MoveList generate_legal_moves_unordered(const Board& board);
+    /**
+     * @brief Generate the legal moves that get the king out of check
+     * 
+     * Only meaningful when the side to move is in check. In double check
+     * only king moves are generated; against a single checker the other
+     * pieces are limited to capturing it or interposing on the squares
+     * between it and the king.
+     * 
+     * @param board The current board position (side to move in check)
+     * @return Move list containing all legal check evasions (unordered)
+     */
+    MoveList generate_evasions(const Board& board);
     /**
      * @brief Generate all capture moves for the current position
      * 
@@ -76,9 +99,9 @@ public:
      * en passant captures.
      * 
      * @param board The current board position
-     * @return Vector containing all capture moves
+     * @return Move list containing all capture moves
      */
-    std::vector<Move> generate_captures(const Board& board);
+    MoveList generate_captures(const Board& board);
     /**
      * @brief Generate all quiet (non-capture) moves for the current position
      * 
@@ -86,9 +109,39 @@ public:
      * and pawn pushes.
      * 
      * @param board The current board position
-     * @return Vector containing all quiet moves
+     * @return Move list containing all quiet moves
+     */
+    MoveList generate_quiet_moves(const Board& board);
+    /**
+     * @brief Append pseudo-legal captures without ordering them
+     * 
+     * Same move set as generate_captures(const Board&) but skips the
+     * MVV-LVA sort, for callers that score moves themselves.
+     * 
+     * @param board The current board position
+     * @param moves Move list to append generated captures to
      */
-    std::vector<Move> generate_quiet_moves(const Board& board);
+    void generate_captures(const Board& board, MoveList& moves);
+    /**
+     * @brief Append pseudo-legal quiet moves
+     * 
+     * Same move set as generate_quiet_moves(const Board&), appended to an
+     * existing list so a staged move picker can fill one buffer.
+     * 
+     * @param board The current board position
+     * @param moves Move list to append generated quiet moves to
+     */
+    void generate_quiet_moves(const Board& board, MoveList& moves);
+    /**
+     * @brief Append pseudo-legal non-capturing promotions
+     * 
+     * These are also part of the quiet move set; search stages that only
+     * look at material-changing moves use this to pick them up early.
+     * 
+     * @param board The current board position
+     * @param moves Move list to append generated promotions to
+     */
+    void generate_promotions(const Board& board, MoveList& moves);
 
     // Specific piece move generation
     /**
@@ -98,20 +151,20 @@ public:
      * and promotions.
      * 
      * @param board The current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      * @param captures_only If true, only generate capture moves
      */
-    void generate_pawn_moves(const Board& board, std::vector<Move>& moves, bool captures_only = false);
+    void generate_pawn_moves(const Board& board, MoveList& moves, bool captures_only = false);
     /**
      * @brief Generate all knight moves for the current position
      * 
      * Generates all possible knight moves using pre-computed attack patterns.
      * 
      * @param board The current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      * @param captures_only If true, only generate capture moves
      */
-    void generate_knight_moves(const Board& board, std::vector<Move>& moves, bool captures_only = false);
+    void generate_knight_moves(const Board& board, MoveList& moves, bool captures_only = false);
     /**
      * @brief Generate all bishop moves for the current position
      * 
@@ -119,10 +172,10 @@ public:
      * efficient attack generation.
      * 
      * @param board The current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      * @param captures_only If true, only generate capture moves
      */
-    void generate_bishop_moves(const Board& board, std::vector<Move>& moves, bool captures_only = false);
+    void generate_bishop_moves(const Board& board, MoveList& moves, bool captures_only = false);
     /**
      * @brief Generate all rook moves for the current position
      * 
@@ -130,10 +183,10 @@ public:
      * for efficient attack generation.
      * 
      * @param board The current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      * @param captures_only If true, only generate capture moves
      */
-    void generate_rook_moves(const Board& board, std::vector<Move>& moves, bool captures_only = false);
+    void generate_rook_moves(const Board& board, MoveList& moves, bool captures_only = false);
     /**
      * @brief Generate all queen moves for the current position
      * 
@@ -141,10 +194,10 @@ public:
      * using magic bitboards.
      * 
      * @param board The current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      * @param captures_only If true, only generate capture moves
      */
-    void generate_queen_moves(const Board& board, std::vector<Move>& moves, bool captures_only = false);
+    void generate_queen_moves(const Board& board, MoveList& moves, bool captures_only = false);
     /**
      * @brief Generate all king moves for the current position
      * 
@@ -152,10 +205,10 @@ public:
      * that would put the king in check.
      * 
      * @param board The current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      * @param captures_only If true, only generate capture moves
      */
-    void generate_king_moves(const Board& board, std::vector<Move>& moves, bool captures_only = false);
+    void generate_king_moves(const Board& board, MoveList& moves, bool captures_only = false);
 
     // Special moves
     /**
@@ -166,9 +219,9 @@ public:
      * king not in check, king doesn't pass through check).
      * 
      * @param board The current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      */
-    void generate_castling_moves(const Board& board, std::vector<Move>& moves);
+    void generate_castling_moves(const Board& board, MoveList& moves);
     /**
      * @brief Generate en passant capture moves for the current position
      * 
@@ -176,9 +229,9 @@ public:
      * two squares and is adjacent to one of our pawns.
      * 
      * @param board The current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      */
-    void generate_en_passant_moves(const Board& board, std::vector<Move>& moves);
+    void generate_en_passant_moves(const Board& board, MoveList& moves);
 
     // Check and legality testing
     /**
@@ -216,6 +269,39 @@ public:
      */
     bool is_square_attacked(const Board& board, int square, Board::Color attacking_color);
 
+    // Static exchange evaluation
+    /**
+     * @brief Piece values used by static exchange evaluation
+     *
+     * Same material values as the evaluation, indexed by Board::PieceType.
+     */
+    static constexpr int SEE_VALUES[Board::NUM_PIECE_TYPES] = {100, 325, 335, 500, 975, 20000};
+    /**
+     * @brief Static exchange evaluation of a move
+     * 
+     * Plays out the sequence of captures on the destination square, each
+     * side always recapturing with its least valuable attacker and free to
+     * stop when continuing would lose material. Sliders uncovered behind a
+     * capturing piece (x-rays) join the exchange. Pins are ignored.
+     * 
+     * @param board The current board position
+     * @param move The move to evaluate (usually a capture or promotion)
+     * @return Material balance of the exchange for the moving side, in centipawns
+     */
+    int see(const Board& board, const Move& move);
+    /**
+     * @brief Check whether a move's static exchange value reaches a threshold
+     * 
+     * Equivalent to see(board, move) >= threshold, but stops as soon as the
+     * outcome is decided, which is usually after one or two captures.
+     * 
+     * @param board The current board position
+     * @param move The move to evaluate
+     * @param threshold Minimum material balance in centipawns
+     * @return True if the exchange wins at least threshold
+     */
+    bool see_ge(const Board& board, const Move& move, int threshold);
+
     // Attack generation
     /**
      * @brief Get all squares attacked by the specified color
@@ -305,14 +391,14 @@ private:
      * @brief Add moves from a bitboard to the move list
      * 
      * Helper function that converts bitboard move patterns into Move objects
-     * and adds them to the provided move vector.
+     * and adds them to the provided move list.
      * 
      * @param from_square Bitboard with the source square set
      * @param to_squares Bitboard with destination squares set
      * @param piece_type Type of piece making the move
      * @param color Color of the piece making the move
      * @param board Current board position for capture detection
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      * @param captures_only If true, only add capture moves
      */
     /**
@@ -326,12 +412,12 @@ private:
      * @param piece_type The type of piece making the moves
      * @param color The color of the piece
      * @param board The current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      * @param captures_only If true, only add capture moves
      */
     void add_moves_from_bitboard(Bitboard from_square, Bitboard to_squares,
                                 Board::PieceType piece_type, Board::Color color,
-                                const Board& board, std::vector<Move>& moves, bool captures_only = false);
+                                const Board& board, MoveList& moves, bool captures_only = false);
 
     /**
      * @brief Add pawn moves with special handling for promotions
@@ -343,11 +429,11 @@ private:
      * @param to_squares Bitboard with destination squares set
      * @param color Color of the pawn
      * @param board Current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      * @param is_capture True if this is a capture move
      */
     void add_pawn_moves(int from_square, Bitboard to_squares, Board::Color color,
-                       const Board& board, std::vector<Move>& moves, bool is_capture = false);
+                       const Board& board, MoveList& moves, bool is_capture = false);
 
     /**
      * @brief Add all promotion moves for a pawn reaching the back rank
@@ -359,11 +445,11 @@ private:
      * @param to_square Destination square (0-63)
      * @param color Color of the promoting pawn
      * @param board Current board position
-     * @param moves Vector to append generated moves to
+     * @param moves Move list to append generated moves to
      * @param is_capture True if this is a capture promotion
      */
     void add_promotion_moves(int from_square, int to_square, Board::Color color,
-                            const Board& board, std::vector<Move>& moves, bool is_capture = false);
+                            const Board& board, MoveList& moves, bool is_capture = false);
 
     // Castling helpers
     /**
@@ -412,17 +498,6 @@ private:
      * @return Bitboard with blocking/capture squares set to 1
      */
     Bitboard get_check_mask(const Board& board, Board::Color color);
-    /**
-     * @brief Get squares between two given squares
-     * 
-     * Returns a bitboard with all squares on the line between
-     * two squares (exclusive of the endpoints).
-     * 
-     * @param sq1 First square (0-63)
-     * @param sq2 Second square (0-63)
-     * @return Bitboard with squares between sq1 and sq2 set to 1
-     */
-    Bitboard get_between_squares(int sq1, int sq2);
     /**
      * @brief Get all pieces attacking a specific square
      * 
@@ -435,33 +510,45 @@ private:
      * @return Bitboard with attacking pieces set to 1
      */
     Bitboard get_attackers_to_square(const Board& board, int square, Board::Color attacking_color);
+    /**
+     * @brief Get all pieces attacking a square through a given occupancy
+     * 
+     * Sliders see through squares missing from occupancy, which lets
+     * static exchange evaluation find x-ray attackers.
+     * 
+     * @param board The current board position
+     * @param square The target square (0-63)
+     * @param attacking_color The color of attacking pieces
+     * @param occupancy Occupied squares to use for sliding attacks
+     * @return Bitboard with attacking pieces set to 1
+     */
+    Bitboard get_attackers_to_square(const Board& board, int square, Board::Color attacking_color, Bitboard occupancy);
 
-    // Move filtering and legality
+    // Strictly legal generation
     /**
-     * @brief Check if a move is legal when the king is in check
+     * @brief Generate legal moves for every piece except the king
      * 
-     * Specialized legality check for positions where the king is in check.
-     * Uses check mask and pinned pieces for efficient validation.
+     * Pinned pieces are restricted to the line through their king and
+     * destinations outside target_mask are dropped, so every move produced
+     * is legal without being played. En passant captures are validated with
+     * Board::is_move_legal to catch discovered checks along the rank.
      * 
      * @param board The current board position
-     * @param move The move to validate
-     * @param check_mask Bitboard indicating blocking/capture squares
+     * @param moves Move list to append generated moves to
+     * @param target_mask Allowed destination squares (FULL_BOARD when not in check)
      * @param pinned_pieces Bitboard of pieces pinned to the king
-     * @return True if the move is legal, false otherwise
      */
-    bool is_move_legal_in_check(const Board& board, const Move& move, Bitboard check_mask, Bitboard pinned_pieces);
+    void generate_legal_piece_moves(const Board& board, MoveList& moves, Bitboard target_mask, Bitboard pinned_pieces);
     /**
-     * @brief Check if three squares are aligned on the same rank, file, or diagonal
+     * @brief Generate legal king moves (excluding castling)
      * 
-     * Utility function to determine if three squares lie on the same line,
-     * useful for pin and discovery attack detection.
+     * Destination squares are tested with the king removed from the
+     * occupancy, so the king cannot step back along a slider's ray.
      * 
-     * @param sq1 First square (0-63)
-     * @param sq2 Second square (0-63)
-     * @param sq3 Third square (0-63)
-     * @return True if all three squares are aligned, false otherwise
+     * @param board The current board position
+     * @param moves Move list to append generated moves to
      */
-    bool are_squares_aligned(int sq1, int sq2, int sq3);
+    void generate_legal_king_moves(const Board& board, MoveList& moves);
 
     // Move ordering
     /**
@@ -470,20 +557,20 @@ private:
      * Sorts moves to improve alpha-beta pruning efficiency by placing
      * potentially better moves first.
      * 
-     * @param moves Vector of moves to order
+     * @param moves List of moves to order
      * @param board The current board position
      */
-    void order_moves(std::vector<Move>& moves, const Board& board);
+    void order_moves(MoveList& moves, const Board& board);
     /**
      * @brief Order capture moves by Most Valuable Victim - Least Valuable Attacker
      * 
      * Sorts capture moves to prioritize capturing high-value pieces
      * with low-value pieces.
      * 
-     * @param moves Vector of capture moves to order
+     * @param moves List of capture moves to order
      * @param board The current board position
      */
-    void order_captures(std::vector<Move>& moves, const Board& board);
+    void order_captures(MoveList& moves, const Board& board);
     /**
      * @brief Get a heuristic score for move ordering
      * 
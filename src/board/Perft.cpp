@@ -0,0 +1,119 @@
+#include "Perft.h"
+#include <algorithm>
+#include <thread>
+
+Perft::Perft() : Perft(Options()) {}
+
+Perft::Perft(const Options& options) : options(options) {
+    if (options.hash_mb == 0) {
+        return;
+    }
+
+    // Largest power of two number of entries that fits the requested size
+    size_t entries = options.hash_mb * 1024 * 1024 / sizeof(HashEntry);
+    size_t size = 1;
+    while (size * 2 <= entries) {
+        size *= 2;
+    }
+    hash_table = std::make_unique<HashEntry[]>(size);
+    hash_mask = size - 1;
+}
+
+Perft::Result Perft::divide(const Board& board, int depth) {
+    auto start = std::chrono::steady_clock::now();
+    Result result;
+
+    if (depth <= 0) {
+        result.nodes = 1;
+    } else {
+        Board root = board;
+        MoveGenerator generator;
+        MoveList moves = generator.generate_legal_moves_unordered(root);
+        for (const Move& move : moves) {
+            result.divide.push_back({move, 0});
+        }
+
+        // Root moves are handed out one at a time, so threads that draw
+        // small subtrees simply take more of them
+        std::atomic<size_t> next_move{0};
+        auto count_root_moves = [&]() {
+            Board thread_board = board;
+            MoveGenerator thread_generator;
+            for (size_t i = next_move++; i < result.divide.size(); i = next_move++) {
+                BitboardMoveUndoData undo_data = thread_board.apply_move(result.divide[i].move);
+                result.divide[i].nodes = depth == 1 ? 1 : count_nodes(thread_board, thread_generator, depth - 1);
+                thread_board.undo_move(undo_data);
+            }
+        };
+
+        int helper_count = std::min(options.threads, static_cast<int>(moves.size())) - 1;
+        std::vector<std::thread> helpers;
+        for (int i = 0; i < helper_count; ++i) {
+            helpers.emplace_back(count_root_moves);
+        }
+        count_root_moves();
+        for (std::thread& helper : helpers) {
+            helper.join();
+        }
+
+        for (const DivideEntry& entry : result.divide) {
+            result.nodes += entry.nodes;
+        }
+    }
+
+    result.time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    return result;
+}
+
+void Perft::clear_hash() {
+    for (size_t i = 0; hash_table && i <= hash_mask; ++i) {
+        hash_table[i].check.store(0, std::memory_order_relaxed);
+        hash_table[i].data.store(0, std::memory_order_relaxed);
+    }
+}
+
+uint64_t Perft::count_nodes(Board& board, MoveGenerator& generator, int depth) {
+    if (depth == 0) {
+        return 1;
+    }
+
+    if (depth == 1 && options.bulk_counting) {
+        return generator.generate_legal_moves_unordered(board).size();
+    }
+
+    uint64_t key = board.get_hash_key();
+    uint64_t nodes = 0;
+    if (hash_table && depth >= 2 && probe(key, depth, nodes)) {
+        return nodes;
+    }
+
+    MoveList moves = generator.generate_legal_moves_unordered(board);
+    for (const Move& move : moves) {
+        BitboardMoveUndoData undo_data = board.apply_move(move);
+        nodes += count_nodes(board, generator, depth - 1);
+        board.undo_move(undo_data);
+    }
+
+    if (hash_table && depth >= 2) {
+        store(key, depth, nodes);
+    }
+    return nodes;
+}
+
+bool Perft::probe(uint64_t key, int depth, uint64_t& nodes) const {
+    const HashEntry& entry = hash_table[key & hash_mask];
+    uint64_t data = entry.data.load(std::memory_order_relaxed);
+    uint64_t check = entry.check.load(std::memory_order_relaxed);
+    if ((check ^ data) != key || static_cast<int>(data & 0xFF) != depth) {
+        return false;
+    }
+    nodes = data >> 8;
+    return true;
+}
+
+void Perft::store(uint64_t key, int depth, uint64_t nodes) {
+    HashEntry& entry = hash_table[key & hash_mask];
+    uint64_t data = (nodes << 8) | static_cast<uint64_t>(depth);
+    entry.data.store(data, std::memory_order_relaxed);
+    entry.check.store(key ^ data, std::memory_order_relaxed);
+}
@@ -0,0 +1,164 @@
+#ifndef PERFT_H
+#define PERFT_H
+
+#include "Board.h"
+#include "Move.h"
+#include "MoveGenerator.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Counts the leaf nodes of the legal move tree (performance test)
+ *
+ * Perft is the correctness oracle of the move generator: the counts of the
+ * reference positions below are known exactly, and any bug in move
+ * generation, make or undo changes them. It is also the headline measure of
+ * move generation speed.
+ *
+ * At the last ply the legal moves are counted without being played (bulk
+ * counting). An optional table of (position key, depth) -> count lets
+ * transpositions be counted once. divide() reports the count below every
+ * root move and can split the root moves across threads, which then share
+ * the table.
+ */
+class Perft {
+public:
+    /**
+     * @brief Standard perft position with its known node counts
+     */
+    struct ReferencePosition {
+        const char* name;
+        const char* fen;
+        std::array<uint64_t, 6> nodes;   ///< nodes[d - 1] is the count at depth d
+    };
+
+    /// Reference positions of the Chess Programming Wiki perft suite
+    static constexpr std::array<ReferencePosition, 6> REFERENCE_POSITIONS = {{
+        {"startpos", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+         {20, 400, 8902, 197281, 4865609, 119060324}},
+        {"kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+         {48, 2039, 97862, 4085603, 193690690, 8031647685}},
+        {"position3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+         {14, 191, 2812, 43238, 674624, 11030083}},
+        {"position4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+         {6, 264, 9467, 422333, 15833292, 706045033}},
+        {"position5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+         {44, 1486, 62379, 2103487, 89941194, 3048196529}},
+        {"position6", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+         {46, 2079, 89890, 3894594, 164075551, 6923051137}},
+    }};
+
+    /**
+     * @brief How a count is computed
+     */
+    struct Options {
+        int threads = 1;              ///< Threads the root moves are split across
+        size_t hash_mb = 0;           ///< Size of the count table (0 = no table)
+        bool bulk_counting = true;    ///< Count the last ply without playing its moves
+    };
+
+    /**
+     * @brief Count below one root move
+     */
+    struct DivideEntry {
+        Move move;
+        uint64_t nodes = 0;
+    };
+
+    /**
+     * @brief Outcome of a count
+     */
+    struct Result {
+        uint64_t nodes = 0;                    ///< Leaf nodes at the requested depth
+        std::vector<DivideEntry> divide;       ///< Count below every root move, in generation order
+        std::chrono::microseconds time{0};     ///< Wall-clock time of the count
+
+        /**
+         * @brief Get the speed of the count in leaf nodes per second
+         */
+        uint64_t nodes_per_second() const {
+            return time.count() > 0 ? nodes * 1000000 / static_cast<uint64_t>(time.count()) : 0;
+        }
+    };
+
+    /**
+     * @brief Constructor - one thread, no table, bulk counting
+     */
+    Perft();
+
+    /**
+     * @brief Constructor
+     *
+     * @param options Threads, table size and counting method
+     */
+    explicit Perft(const Options& options);
+
+    /**
+     * @brief Count the leaf nodes of a position, with the count below every root move
+     *
+     * The table is kept between calls, so repeated counts get faster.
+     *
+     * @param board Position to count (not modified)
+     * @param depth Depth in plies (depth 0 counts the position itself)
+     * @return Total and per-root-move counts with timing
+     */
+    Result divide(const Board& board, int depth);
+
+    /**
+     * @brief Count the leaf nodes of a position
+     *
+     * @param board Position to count (not modified)
+     * @param depth Depth in plies
+     * @return Number of leaf nodes
+     */
+    uint64_t count(const Board& board, int depth) { return divide(board, depth).nodes; }
+
+    /**
+     * @brief Forget every stored count
+     */
+    void clear_hash();
+
+private:
+    /**
+     * @brief Count table entry, written without locks by several threads
+     *
+     * data packs the depth (low 8 bits) with the count; check holds
+     * key ^ data, so an entry torn by two concurrent writers fails the key
+     * comparison instead of returning a wrong count.
+     */
+    struct HashEntry {
+        std::atomic<uint64_t> check{0};
+        std::atomic<uint64_t> data{0};
+    };
+
+    Options options;
+    std::unique_ptr<HashEntry[]> hash_table;
+    size_t hash_mask = 0;                         ///< Entry count - 1 (a power of two)
+
+    /**
+     * @brief Count the leaf nodes below a position on one thread
+     *
+     * @param board Position, restored before returning
+     * @param generator Move generator of the calling thread
+     * @param depth Remaining depth (0 counts the position itself)
+     */
+    uint64_t count_nodes(Board& board, MoveGenerator& generator, int depth);
+
+    /**
+     * @brief Look up a stored count
+     *
+     * @return true if the count for this key and depth was found
+     */
+    bool probe(uint64_t key, int depth, uint64_t& nodes) const;
+
+    /**
+     * @brief Store a count, replacing whatever was in its slot
+     */
+    void store(uint64_t key, int depth, uint64_t nodes);
+};
+
+#endif // PERFT_H
@@ -0,0 +1,43 @@
+#include "Zobrist.h"
+#include <mutex>
+#include <random>
+
+// Static member initialization
+std::array<std::array<std::array<uint64_t, 64>, 6>, 2> Zobrist::piece_keys;
+std::array<uint64_t, 16> Zobrist::castling_keys;
+std::array<uint64_t, 8> Zobrist::en_passant_keys;
+uint64_t Zobrist::side_key = 0;
+std::once_flag Zobrist::init_flag;
+
+void Zobrist::init() {
+    // Boards are created on several threads at once (search helpers, batch
+    // workers, C API handles); call_once makes the others wait for the keys
+    std::call_once(init_flag, fill_keys);
+}
+
+void Zobrist::fill_keys() {
+    std::mt19937_64 rng(0x1234567890ABCDEF); // Fixed seed for reproducibility
+    std::uniform_int_distribution<uint64_t> dist;
+
+    // Initialize piece keys
+    for (int color = 0; color < 2; ++color) {
+        for (int piece = 0; piece < 6; ++piece) {
+            for (int square = 0; square < 64; ++square) {
+                piece_keys[color][piece][square] = dist(rng);
+            }
+        }
+    }
+
+    // Initialize castling keys
+    for (int i = 0; i < 16; ++i) {
+        castling_keys[i] = dist(rng);
+    }
+
+    // Initialize en passant keys
+    for (int i = 0; i < 8; ++i) {
+        en_passant_keys[i] = dist(rng);
+    }
+
+    // Initialize side to move key
+    side_key = dist(rng);
+}
@@ -0,0 +1,74 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <cstdint>
+#include <array>
+#include <mutex>
+
+/**
+ * Zobrist - Random keys for position hashing
+ *
+ * Holds the precomputed random keys for every component of a chess position.
+ * Board XORs these into its position and pawn keys as moves are made, so a
+ * key is always available without rehashing the whole board.
+ */
+class Zobrist {
+public:
+    /**
+     * Initialize all Zobrist keys from a fixed seed.
+     * Must be called before any key is read; Board's constructor does this.
+     * Thread-safe: concurrent first calls fill the keys exactly once.
+     */
+    static void init();
+
+    /**
+     * Key for a piece standing on a square.
+     * @param color Color index (0=white, 1=black)
+     * @param piece_type Piece type index (0=pawn ... 5=king)
+     * @param square The square index (0-63)
+     * @return The random key for this piece/square combination
+     */
+    static uint64_t piece_key(int color, int piece_type, int square) {
+        return piece_keys[color][piece_type][square];
+    }
+
+    /**
+     * Key for a castling rights combination.
+     * @param castling_rights Castling rights in KQkq bit format (0-15)
+     * @return The random key for these rights
+     */
+    static uint64_t castling_key(uint8_t castling_rights) {
+        return castling_keys[castling_rights & 0x0F];
+    }
+
+    /**
+     * Key for an en passant file.
+     * @param file The en passant file (0-7)
+     * @return The random key for this file
+     */
+    static uint64_t en_passant_key(int file) {
+        return en_passant_keys[file];
+    }
+
+    /**
+     * Key XORed in when black is to move.
+     * @return The side to move key
+     */
+    static uint64_t side_to_move_key() {
+        return side_key;
+    }
+
+private:
+    static std::array<std::array<std::array<uint64_t, 64>, 6>, 2> piece_keys; // [color][piece_type][square]
+    static std::array<uint64_t, 16> castling_keys;
+    static std::array<uint64_t, 8> en_passant_keys;
+    static uint64_t side_key;
+    static std::once_flag init_flag;
+
+    /**
+     * Draw every key from the fixed seed (run once by init()).
+     */
+    static void fill_keys();
+};
+
+#endif // ZOBRIST_H
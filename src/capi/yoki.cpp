@@ -0,0 +1,293 @@
+#include "yoki.h"
+#include "../board/Board.h"
+#include "../board/MoveGenerator.h"
+#include "../engine/Engine.h"
+#include "../engine/Search.h"
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+
+/**
+ * @brief Engine behind a C handle
+ *
+ * The mutex only guards running, so that yoki_stop() from another thread
+ * reaches the search it was meant for and never the next one.
+ */
+struct yoki_engine {
+    Engine engine;
+    std::mutex search_mutex;
+    bool running = false;    ///< A yoki_search() is between start_search() and wait()
+};
+
+namespace {
+
+constexpr int DEFAULT_DEPTH = 8;   ///< Depth searched when no limit is set
+
+/**
+ * @brief Copy a string into a caller's buffer including the terminating NUL
+ *
+ * @return YOKI_OK, or YOKI_ERROR_BUFFER_TOO_SMALL (leaving an empty string if possible)
+ */
+int copy_string(const std::string& text, char* buffer, size_t buffer_size) {
+    if (text.size() >= buffer_size) {
+        if (buffer_size > 0) {
+            buffer[0] = '\0';
+        }
+        return YOKI_ERROR_BUFFER_TOO_SMALL;
+    }
+    std::memcpy(buffer, text.c_str(), text.size() + 1);
+    return YOKI_OK;
+}
+
+/**
+ * @brief Translate the C limits into search limits
+ *
+ * @return false if a limit is negative
+ */
+bool to_search_limits(const yoki_limits* limits, Search::SearchLimits& result) {
+    if (!limits) {
+        result.depth = DEFAULT_DEPTH;
+        return true;
+    }
+    if (limits->depth < 0 || limits->movetime_ms < 0 || limits->nodes < 0 || limits->time_left_ms < 0 ||
+        limits->increment_ms < 0 || limits->moves_to_go < 0) {
+        return false;
+    }
+
+    result.depth = limits->depth;
+    result.move_time = std::chrono::milliseconds(limits->movetime_ms);
+    result.nodes = limits->nodes;
+    result.time_control.time_left = std::chrono::milliseconds(limits->time_left_ms);
+    result.time_control.increment = std::chrono::milliseconds(limits->increment_ms);
+    result.time_control.moves_to_go = limits->moves_to_go;
+    if (result.depth == 0 && result.move_time.count() == 0 && result.nodes == 0 &&
+        result.time_control.time_left.count() == 0) {
+        result.depth = DEFAULT_DEPTH;
+    }
+    return true;
+}
+
+/**
+ * @brief Fill the C result from a search result
+ */
+void to_c_result(const Search::SearchResult& result, yoki_result* out) {
+    std::memset(out, 0, sizeof(*out));
+    std::string best = result.best_move.is_null() ? "0000" : result.best_move.to_algebraic();
+    copy_string(best, out->bestmove, sizeof(out->bestmove));
+    if (result.pv.size() > 1) {
+        copy_string(result.pv[1].to_algebraic(), out->ponder, sizeof(out->ponder));
+    }
+    out->score_cp = result.is_mate ? 0 : result.score;
+    out->mate = result.is_mate ? result.mate_in : 0;
+    out->depth = result.depth;
+    out->nodes = static_cast<int64_t>(result.stats.nodes_searched);
+    out->time_ms = static_cast<int64_t>(result.stats.time_elapsed.count());
+
+    // Keep whole moves only when a long variation does not fit
+    std::string pv;
+    for (size_t i = 0; i < result.pv.size(); ++i) {
+        std::string move = result.pv[i].to_algebraic();
+        if (pv.size() + move.size() + 1 >= sizeof(out->pv)) {
+            break;
+        }
+        pv += (i > 0 ? " " : "") + move;
+    }
+    copy_string(pv, out->pv, sizeof(out->pv));
+}
+
+} // namespace
+
+extern "C" {
+
+int yoki_abi_version(void) {
+    return YOKI_ABI_VERSION;
+}
+
+const char* yoki_version(void) {
+    return "Yoki " YOKI_VERSION;
+}
+
+yoki_engine* yoki_create(void) {
+    try {
+        return new yoki_engine();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void yoki_destroy(yoki_engine* engine) {
+    if (!engine) {
+        return;
+    }
+    try {
+        engine->engine.get_search().stop();
+    } catch (...) {
+    }
+    delete engine;
+}
+
+int yoki_set_hash(yoki_engine* engine, int size_mb) {
+    if (!engine || size_mb < 1) {
+        return YOKI_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        engine->engine.get_search().set_hash_size(static_cast<size_t>(size_mb));
+        return YOKI_OK;
+    } catch (...) {
+        return YOKI_ERROR_INTERNAL;
+    }
+}
+
+int yoki_set_threads(yoki_engine* engine, int threads) {
+    if (!engine || threads < 1) {
+        return YOKI_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        engine->engine.get_search().set_threads(threads);
+        return YOKI_OK;
+    } catch (...) {
+        return YOKI_ERROR_INTERNAL;
+    }
+}
+
+int yoki_new_game(yoki_engine* engine) {
+    if (!engine) {
+        return YOKI_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        engine->engine.new_game();
+        return YOKI_OK;
+    } catch (...) {
+        return YOKI_ERROR_INTERNAL;
+    }
+}
+
+int yoki_set_position(yoki_engine* engine, const char* fen, const char* const* moves, int move_count) {
+    if (!engine || move_count < 0 || (move_count > 0 && !moves)) {
+        return YOKI_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        std::string start = fen ? fen : Engine::START_FEN;
+        if (!Board::is_valid_fen(start)) {
+            return YOKI_ERROR_INVALID_FEN;
+        }
+        for (int i = 0; i < move_count; ++i) {
+            if (!moves[i]) {
+                return YOKI_ERROR_INVALID_ARGUMENT;
+            }
+        }
+
+        std::string previous = engine->engine.get_current_position();
+        engine->engine.set_position(start);
+        for (int i = 0; i < move_count; ++i) {
+            if (!engine->engine.make_move(moves[i])) {
+                engine->engine.set_position(previous);
+                return YOKI_ERROR_ILLEGAL_MOVE;
+            }
+        }
+        return YOKI_OK;
+    } catch (...) {
+        return YOKI_ERROR_INTERNAL;
+    }
+}
+
+int yoki_make_move(yoki_engine* engine, const char* move) {
+    if (!engine || !move) {
+        return YOKI_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return engine->engine.make_move(move) ? YOKI_OK : YOKI_ERROR_ILLEGAL_MOVE;
+    } catch (...) {
+        return YOKI_ERROR_INTERNAL;
+    }
+}
+
+int yoki_get_fen(yoki_engine* engine, char* buffer, size_t buffer_size) {
+    if (!engine || !buffer) {
+        return YOKI_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        return copy_string(engine->engine.get_current_position(), buffer, buffer_size);
+    } catch (...) {
+        return YOKI_ERROR_INTERNAL;
+    }
+}
+
+int yoki_legal_moves(yoki_engine* engine, char* buffer, size_t buffer_size) {
+    if (!engine || !buffer) {
+        return YOKI_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        Board board = engine->engine.get_board();
+        MoveGenerator generator;
+        MoveList moves = generator.generate_legal_moves(board);
+
+        std::string text;
+        for (size_t i = 0; i < moves.size(); ++i) {
+            text += (i > 0 ? " " : "") + moves[i].to_algebraic();
+        }
+        int status = copy_string(text, buffer, buffer_size);
+        return status == YOKI_OK ? static_cast<int>(moves.size()) : status;
+    } catch (...) {
+        return YOKI_ERROR_INTERNAL;
+    }
+}
+
+int yoki_evaluate(yoki_engine* engine, int* score_cp) {
+    if (!engine || !score_cp) {
+        return YOKI_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        const Board& board = engine->engine.get_board();
+        int score = engine->engine.get_evaluation().evaluate(board);
+        *score_cp = board.get_active_color() == Board::WHITE ? score : -score;
+        return YOKI_OK;
+    } catch (...) {
+        return YOKI_ERROR_INTERNAL;
+    }
+}
+
+int yoki_search(yoki_engine* engine, const yoki_limits* limits, yoki_result* result) {
+    if (!engine || !result) {
+        return YOKI_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        Search::SearchLimits search_limits;
+        if (!to_search_limits(limits, search_limits)) {
+            return YOKI_ERROR_INVALID_ARGUMENT;
+        }
+
+        Search& search = engine->engine.get_search();
+        {
+            std::lock_guard<std::mutex> lock(engine->search_mutex);
+            search.start_search(engine->engine.get_board(), search_limits);
+            engine->running = true;
+        }
+        Search::SearchResult search_result = search.wait();
+        {
+            std::lock_guard<std::mutex> lock(engine->search_mutex);
+            engine->running = false;
+        }
+
+        to_c_result(search_result, result);
+        return YOKI_OK;
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(engine->search_mutex);
+        engine->running = false;
+        return YOKI_ERROR_INTERNAL;
+    }
+}
+
+void yoki_stop(yoki_engine* engine) {
+    if (!engine) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(engine->search_mutex);
+    if (engine->running) {
+        engine->engine.get_search().request_stop();
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,210 @@
+#ifndef YOKI_H
+#define YOKI_H
+
+/**
+ * @file yoki.h
+ * @brief Stable C interface of the Yoki chess engine (libyoki)
+ *
+ * Every function takes plain C types, never throws, and reports failure
+ * through a negative YOKI_ERROR_* code. Structures are passed by pointer and
+ * only ever grow at the end; YOKI_ABI_VERSION is bumped on any incompatible
+ * change and can be checked at run time with yoki_abi_version().
+ *
+ * Each engine handle owns a search with its transposition table, history
+ * and evaluation, which stay warm between calls. A handle must not be used
+ * from two threads at once, with one exception: yoki_stop() may be called
+ * from any thread while yoki_search() runs. Different handles are fully
+ * independent and may be created and used on different threads at once; the
+ * read-only tables they share are filled exactly once, by the first handle.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  define YOKI_API __declspec(dllexport)
+#else
+#  define YOKI_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define YOKI_ABI_VERSION 1
+#define YOKI_VERSION "1.0.0"
+
+/** Longest move in UCI notation ("e7e8q") plus the terminating NUL */
+#define YOKI_MOVE_SIZE 6
+/** Buffer size that always holds every legal move of a position, space separated */
+#define YOKI_MOVES_BUFFER_SIZE (256 * YOKI_MOVE_SIZE)
+/** Buffer size that always holds a FEN string */
+#define YOKI_FEN_BUFFER_SIZE 128
+/** Size of yoki_result.pv */
+#define YOKI_PV_BUFFER_SIZE (64 * YOKI_MOVE_SIZE)
+
+/** Result codes (YOKI_OK or a negative error) */
+enum {
+    YOKI_OK = 0,
+    YOKI_ERROR_INVALID_ARGUMENT = -1,   /**< Null handle or pointer, or a negative limit */
+    YOKI_ERROR_INVALID_FEN = -2,        /**< The FEN does not describe a legal position */
+    YOKI_ERROR_ILLEGAL_MOVE = -3,       /**< A move is not legal in its position */
+    YOKI_ERROR_BUFFER_TOO_SMALL = -4,   /**< The output buffer cannot hold the answer */
+    YOKI_ERROR_INTERNAL = -5            /**< Unexpected failure inside the engine */
+};
+
+/** Opaque engine handle */
+typedef struct yoki_engine yoki_engine;
+
+/**
+ * @brief Limits of a search; zero means "not set" for every field
+ *
+ * With no limit set at all, a depth of 8 is searched.
+ */
+typedef struct yoki_limits {
+    int depth;          /**< Deepest iteration */
+    int movetime_ms;    /**< Fixed time for the move */
+    int nodes;          /**< Approximate node budget */
+    int time_left_ms;   /**< Clock of the side to move */
+    int increment_ms;   /**< Increment of the side to move */
+    int moves_to_go;    /**< Moves until the next time control */
+} yoki_limits;
+
+/**
+ * @brief Result of a search
+ */
+typedef struct yoki_result {
+    char bestmove[YOKI_MOVE_SIZE];    /**< Best move in UCI notation, "0000" without legal moves */
+    char ponder[YOKI_MOVE_SIZE];      /**< Expected reply, empty if unknown */
+    int score_cp;                     /**< Score in centipawns from the side to move (when mate is 0) */
+    int mate;                         /**< Moves to mate: positive if the side to move mates, 0 if none */
+    int depth;                        /**< Last completed iteration */
+    int64_t nodes;                    /**< Nodes searched */
+    int64_t time_ms;                  /**< Search time */
+    char pv[YOKI_PV_BUFFER_SIZE];     /**< Principal variation, moves separated by spaces */
+} yoki_result;
+
+/** @return YOKI_ABI_VERSION of the loaded library */
+YOKI_API int yoki_abi_version(void);
+
+/** @return Engine name and library version, e.g. "Yoki 1.0.0" (static storage) */
+YOKI_API const char* yoki_version(void);
+
+/**
+ * @brief Create an engine set to the starting position
+ *
+ * @return New handle, or NULL if it could not be created
+ */
+YOKI_API yoki_engine* yoki_create(void);
+
+/**
+ * @brief Destroy an engine (stopping any search) and free its memory
+ *
+ * @param engine Handle from yoki_create(), or NULL
+ */
+YOKI_API void yoki_destroy(yoki_engine* engine);
+
+/**
+ * @brief Resize the transposition table (clears it)
+ *
+ * @param engine Engine handle
+ * @param size_mb Table size in megabytes (at least 1)
+ * @return YOKI_OK or an error code
+ */
+YOKI_API int yoki_set_hash(yoki_engine* engine, int size_mb);
+
+/**
+ * @brief Set the number of threads used by each search
+ *
+ * @param engine Engine handle
+ * @param threads Thread count (at least 1)
+ * @return YOKI_OK or an error code
+ */
+YOKI_API int yoki_set_threads(yoki_engine* engine, int threads);
+
+/**
+ * @brief Forget the transposition table and history, e.g. between games
+ *
+ * @param engine Engine handle
+ * @return YOKI_OK or an error code
+ */
+YOKI_API int yoki_new_game(yoki_engine* engine);
+
+/**
+ * @brief Set the position from a FEN and a list of moves played from it
+ *
+ * On failure the previous position is kept.
+ *
+ * @param engine Engine handle
+ * @param fen FEN string, or NULL for the starting position
+ * @param moves Moves in UCI notation (may be NULL when move_count is 0)
+ * @param move_count Number of moves
+ * @return YOKI_OK, YOKI_ERROR_INVALID_FEN or YOKI_ERROR_ILLEGAL_MOVE
+ */
+YOKI_API int yoki_set_position(yoki_engine* engine, const char* fen, const char* const* moves, int move_count);
+
+/**
+ * @brief Play one move on the current position
+ *
+ * @param engine Engine handle
+ * @param move Move in UCI notation, e.g. "e2e4" or "e7e8q"
+ * @return YOKI_OK or YOKI_ERROR_ILLEGAL_MOVE
+ */
+YOKI_API int yoki_make_move(yoki_engine* engine, const char* move);
+
+/**
+ * @brief Write the current position as FEN
+ *
+ * @param engine Engine handle
+ * @param buffer Output buffer (YOKI_FEN_BUFFER_SIZE bytes always suffice)
+ * @param buffer_size Size of buffer in bytes
+ * @return YOKI_OK or an error code
+ */
+YOKI_API int yoki_get_fen(yoki_engine* engine, char* buffer, size_t buffer_size);
+
+/**
+ * @brief List the legal moves of the current position
+ *
+ * @param engine Engine handle
+ * @param buffer Output buffer for the moves, separated by spaces
+ *               (YOKI_MOVES_BUFFER_SIZE bytes always suffice)
+ * @param buffer_size Size of buffer in bytes
+ * @return Number of legal moves, or a negative error code
+ */
+YOKI_API int yoki_legal_moves(yoki_engine* engine, char* buffer, size_t buffer_size);
+
+/**
+ * @brief Static evaluation of the current position
+ *
+ * @param engine Engine handle
+ * @param score_cp Receives the score in centipawns from the side to move
+ * @return YOKI_OK or an error code
+ */
+YOKI_API int yoki_evaluate(yoki_engine* engine, int* score_cp);
+
+/**
+ * @brief Search the current position
+ *
+ * Blocks until a limit is reached or yoki_stop() is called.
+ *
+ * @param engine Engine handle
+ * @param limits Search limits (NULL for the default depth)
+ * @param result Receives the result
+ * @return YOKI_OK or an error code
+ */
+YOKI_API int yoki_search(yoki_engine* engine, const yoki_limits* limits, yoki_result* result);
+
+/**
+ * @brief Make a running yoki_search() return as soon as possible
+ *
+ * May be called from any thread. Has no effect when no search is running.
+ *
+ * @param engine Engine handle
+ */
+YOKI_API void yoki_stop(yoki_engine* engine);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* YOKI_H */
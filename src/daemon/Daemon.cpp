@@ -0,0 +1,475 @@
+#include "Daemon.h"
+#include "../board/MoveGenerator.h"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief A parsed JSON value (objects may not nest)
+ */
+struct JsonValue {
+    enum Type { NUL, BOOLEAN, NUMBER, STRING, ARRAY };
+
+    Type type = NUL;
+    std::string raw;                ///< Source text of the value
+    std::string text;               ///< Decoded string (STRING)
+    double number = 0;              ///< Value (NUMBER)
+    bool boolean = false;           ///< Value (BOOLEAN)
+    std::vector<JsonValue> items;   ///< Elements (ARRAY)
+};
+
+using JsonObject = std::map<std::string, JsonValue>;
+
+/**
+ * @brief Minimal reader for the one-object-per-line request format
+ *
+ * Throws std::runtime_error on malformed input.
+ */
+class JsonReader {
+public:
+    explicit JsonReader(const std::string& text) : text(text) {}
+
+    JsonObject read_object() {
+        JsonObject object;
+        skip_space();
+        expect('{');
+        skip_space();
+        if (peek() == '}') {
+            ++pos;
+        } else {
+            while (true) {
+                skip_space();
+                std::string key = read_string();
+                skip_space();
+                expect(':');
+                object[key] = read_value();
+                skip_space();
+                if (peek() != ',') {
+                    break;
+                }
+                ++pos;
+            }
+            expect('}');
+        }
+        skip_space();
+        if (pos != text.size()) {
+            throw std::runtime_error("unexpected text after the object");
+        }
+        return object;
+    }
+
+private:
+    const std::string& text;
+    size_t pos = 0;
+
+    char peek() const { return pos < text.size() ? text[pos] : '\0'; }
+
+    void skip_space() {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+            ++pos;
+        }
+    }
+
+    void expect(char c) {
+        if (peek() != c) {
+            throw std::runtime_error(std::string("expected '") + c + "'");
+        }
+        ++pos;
+    }
+
+    JsonValue read_value() {
+        skip_space();
+        JsonValue value;
+        size_t start = pos;
+        char c = peek();
+
+        if (c == '"') {
+            value.type = JsonValue::STRING;
+            value.text = read_string();
+        } else if (c == '[') {
+            value.type = JsonValue::ARRAY;
+            ++pos;
+            skip_space();
+            if (peek() == ']') {
+                ++pos;
+            } else {
+                while (true) {
+                    value.items.push_back(read_value());
+                    skip_space();
+                    if (peek() != ',') {
+                        break;
+                    }
+                    ++pos;
+                }
+                expect(']');
+            }
+        } else if (text.compare(pos, 4, "true") == 0 || text.compare(pos, 5, "false") == 0) {
+            value.type = JsonValue::BOOLEAN;
+            value.boolean = c == 't';
+            pos += value.boolean ? 4 : 5;
+        } else if (text.compare(pos, 4, "null") == 0) {
+            pos += 4;
+        } else if (c == '-' || std::isdigit(static_cast<unsigned char>(c))) {
+            while (pos < text.size() && std::string("+-.eE0123456789").find(text[pos]) != std::string::npos) {
+                ++pos;
+            }
+            value.type = JsonValue::NUMBER;
+            value.number = std::stod(text.substr(start, pos - start));
+        } else if (c == '{') {
+            throw std::runtime_error("nested objects are not supported");
+        } else {
+            throw std::runtime_error("invalid value");
+        }
+
+        value.raw = text.substr(start, pos - start);
+        return value;
+    }
+
+    std::string read_string() {
+        expect('"');
+        std::string result;
+        while (true) {
+            if (pos >= text.size()) {
+                throw std::runtime_error("unterminated string");
+            }
+            char c = text[pos++];
+            if (c == '"') {
+                return result;
+            }
+            if (c != '\\') {
+                result += c;
+                continue;
+            }
+            char escape = peek();
+            ++pos;
+            switch (escape) {
+                case '"': case '\\': case '/': result += escape; break;
+                case 'b': result += '\b'; break;
+                case 'f': result += '\f'; break;
+                case 'n': result += '\n'; break;
+                case 'r': result += '\r'; break;
+                case 't': result += '\t'; break;
+                case 'u': {
+                    // Ids and FENs are ASCII; anything else only has to survive the echo
+                    if (pos + 4 > text.size()) {
+                        throw std::runtime_error("invalid escape");
+                    }
+                    unsigned code = static_cast<unsigned>(std::stoul(text.substr(pos, 4), nullptr, 16));
+                    pos += 4;
+                    if (code < 0x80) {
+                        result += static_cast<char>(code);
+                    } else if (code < 0x800) {
+                        result += static_cast<char>(0xC0 | (code >> 6));
+                        result += static_cast<char>(0x80 | (code & 0x3F));
+                    } else {
+                        result += static_cast<char>(0xE0 | (code >> 12));
+                        result += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                        result += static_cast<char>(0x80 | (code & 0x3F));
+                    }
+                    break;
+                }
+                default:
+                    throw std::runtime_error("invalid escape");
+            }
+        }
+    }
+};
+
+/**
+ * @brief Quote a string for JSON output
+ */
+std::string json_string(const std::string& text) {
+    std::string result = "\"";
+    for (char c : text) {
+        switch (c) {
+            case '"': result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                    result += buffer;
+                } else {
+                    result += c;
+                }
+        }
+    }
+    return result + "\"";
+}
+
+/**
+ * @brief Read a non-negative integer limit from a request
+ *
+ * @return The value, or 0 if the key is absent
+ */
+int read_limit(const JsonObject& request, const std::string& key) {
+    auto it = request.find(key);
+    if (it == request.end()) {
+        return 0;
+    }
+    if (it->second.type != JsonValue::NUMBER || it->second.number < 0 || it->second.number > 1e9) {
+        throw std::runtime_error(key + " must be a non-negative number");
+    }
+    return static_cast<int>(it->second.number);
+}
+
+} // namespace
+
+Daemon::Daemon(std::ostream& output) : Daemon(output, Options()) {}
+
+Daemon::Daemon(std::ostream& output, const Options& options) : output(output) {
+    int count = options.workers > 0 ? options.workers : static_cast<int>(std::thread::hardware_concurrency());
+    count = std::max(1, count);
+
+    for (int i = 0; i < count; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+        Search& search = workers.back()->engine.get_search();
+        search.set_hash_size(options.hash_mb);
+        search.set_threads(options.threads_per_search);
+    }
+    for (auto& worker : workers) {
+        worker->thread = std::thread(&Daemon::work, this, std::ref(*worker));
+    }
+}
+
+Daemon::~Daemon() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        shutting_down = true;
+        queue.clear();
+        for (auto& worker : workers) {
+            if (worker->job) {
+                worker->job->cancelled = true;
+                worker->engine.get_search().request_stop();
+            }
+        }
+    }
+    work_available.notify_all();
+    for (auto& worker : workers) {
+        worker->thread.join();
+    }
+}
+
+void Daemon::run(std::istream& input) {
+    std::string line;
+    while (std::getline(input, line)) {
+        if (!submit(line)) {
+            break;
+        }
+    }
+    drain();
+}
+
+bool Daemon::submit(const std::string& line) {
+    if (line.find_first_not_of(" \t\r") == std::string::npos) {
+        return true;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->id = "null";
+    try {
+        JsonObject request = JsonReader(line).read_object();
+        auto id = request.find("id");
+        if (id != request.end()) {
+            job->id = id->second.raw;
+        }
+
+        auto command = request.find("cmd");
+        std::string name = command == request.end() ? "search" : command->second.text;
+        if (name == "quit") {
+            return false;
+        }
+        if (name == "ping") {
+            send("{\"id\":" + job->id + ",\"status\":\"pong\"}");
+            return true;
+        }
+        if (name == "cancel") {
+            if (!cancel(job->id)) {
+                send(error_reply(job->id, "no such request"));
+            }
+            return true;
+        }
+        if (name != "search") {
+            throw std::runtime_error("unknown command " + name);
+        }
+
+        // Search request: validate everything here so the workers never fail
+        auto fen = request.find("fen");
+        job->fen = fen == request.end() ? Engine::START_FEN : fen->second.text;
+        if (!Board::is_valid_fen(job->fen)) {
+            throw std::runtime_error("invalid fen");
+        }
+        Board board;
+        board.set_from_fen(job->fen);
+        auto moves = request.find("moves");
+        if (moves != request.end()) {
+            if (moves->second.type != JsonValue::ARRAY) {
+                throw std::runtime_error("moves must be an array");
+            }
+            MoveGenerator generator;
+            for (const JsonValue& move : moves->second.items) {
+                MoveList legal_moves = generator.generate_legal_moves_unordered(board);
+                auto legal = std::find_if(legal_moves.begin(), legal_moves.end(), [&move](const Move& candidate) {
+                    return candidate.to_algebraic() == move.text;
+                });
+                if (legal == legal_moves.end()) {
+                    throw std::runtime_error("illegal move " + move.text);
+                }
+                board.make_move(*legal);
+                job->moves.push_back(move.text);
+            }
+        }
+
+        Search::SearchLimits& limits = job->limits;
+        limits.depth = read_limit(request, "depth");
+        limits.move_time = std::chrono::milliseconds(read_limit(request, "movetime"));
+        limits.nodes = read_limit(request, "nodes");
+        bool white = board.get_active_color() == Board::WHITE;
+        limits.time_control.time_left = std::chrono::milliseconds(read_limit(request, white ? "wtime" : "btime"));
+        limits.time_control.increment = std::chrono::milliseconds(read_limit(request, white ? "winc" : "binc"));
+        limits.time_control.moves_to_go = read_limit(request, "movestogo");
+        if (limits.depth == 0 && limits.move_time.count() == 0 && limits.nodes == 0 &&
+            limits.time_control.time_left.count() == 0) {
+            limits.depth = DEFAULT_DEPTH;
+        }
+    } catch (const std::exception& e) {
+        send(error_reply(job->id, e.what()));
+        return true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        queue.push_back(job);
+        pending++;
+    }
+    work_available.notify_one();
+    return true;
+}
+
+void Daemon::drain() {
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    all_done.wait(lock, [this] { return pending == 0; });
+}
+
+void Daemon::work(Worker& worker) {
+    while (true) {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            work_available.wait(lock, [this] { return shutting_down || !queue.empty(); });
+            if (shutting_down) {
+                return;
+            }
+            job = queue.front();
+            queue.pop_front();
+            worker.job = job;
+        }
+
+        run_job(worker, *job);
+
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            worker.job.reset();
+        }
+        finish_request();
+    }
+}
+
+void Daemon::run_job(Worker& worker, Job& job) {
+    Engine& engine = worker.engine;
+    engine.set_position(job.fen);
+    for (const std::string& move : job.moves) {
+        // Already checked by submit(); kept so a worker can never search a wrong position
+        if (!engine.make_move(move)) {
+            send(error_reply(job.id, "illegal move " + move));
+            return;
+        }
+    }
+
+    Search& search = engine.get_search();
+    search.start_search(engine.get_board(), job.limits);
+
+    // A cancel that arrived before the search started would have been lost
+    bool cancelled;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        cancelled = job.cancelled;
+    }
+    if (cancelled) {
+        search.request_stop();
+    }
+
+    Search::SearchResult result = search.wait();
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        cancelled = job.cancelled;
+    }
+    send(result_reply(job.id, result, cancelled));
+}
+
+bool Daemon::cancel(const std::string& id) {
+    std::shared_ptr<Job> dropped;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        auto queued = std::find_if(queue.begin(), queue.end(),
+                                   [&id](const std::shared_ptr<Job>& job) { return job->id == id; });
+        if (queued != queue.end()) {
+            dropped = *queued;
+            queue.erase(queued);
+        } else {
+            for (auto& worker : workers) {
+                if (worker->job && worker->job->id == id) {
+                    worker->job->cancelled = true;
+                    worker->engine.get_search().request_stop();
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    send("{\"id\":" + dropped->id + ",\"status\":\"cancelled\"}");
+    finish_request();
+    return true;
+}
+
+void Daemon::send(const std::string& line) {
+    std::lock_guard<std::mutex> lock(output_mutex);
+    output << line << std::endl;
+}
+
+void Daemon::finish_request() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        pending--;
+    }
+    all_done.notify_all();
+}
+
+std::string Daemon::error_reply(const std::string& id, const std::string& message) {
+    return "{\"id\":" + id + ",\"status\":\"error\",\"error\":" + json_string(message) + "}";
+}
+
+std::string Daemon::result_reply(const std::string& id, const Search::SearchResult& result, bool cancelled) {
+    std::string reply = "{\"id\":" + id + ",\"status\":" + (cancelled ? "\"cancelled\"" : "\"ok\"");
+    reply += ",\"bestmove\":" + (result.best_move.is_null() ? std::string("null")
+                                                             : json_string(result.best_move.to_algebraic()));
+    if (result.pv.size() > 1) {
+        reply += ",\"ponder\":" + json_string(result.pv[1].to_algebraic());
+    }
+    reply += result.is_mate ? ",\"score\":{\"mate\":" + std::to_string(result.mate_in) + "}"
+                            : ",\"score\":{\"cp\":" + std::to_string(result.score) + "}";
+    reply += ",\"depth\":" + std::to_string(result.depth) +
+             ",\"nodes\":" + std::to_string(result.stats.nodes_searched) +
+             ",\"time_ms\":" + std::to_string(result.stats.time_elapsed.count()) + ",\"pv\":[";
+    for (size_t i = 0; i < result.pv.size(); ++i) {
+        reply += (i > 0 ? "," : "") + json_string(result.pv[i].to_algebraic());
+    }
+    return reply + "]}";
+}
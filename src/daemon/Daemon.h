@@ -0,0 +1,193 @@
+#ifndef DAEMON_H
+#define DAEMON_H
+
+#include "../engine/Engine.h"
+#include "../engine/Search.h"
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Long-lived engine process speaking newline-delimited JSON
+ *
+ * Keeps a pool of worker threads, each with its own warm Engine (search,
+ * transposition table, history and evaluation), so a backend pays process
+ * start-up and table initialisation once instead of on every request.
+ *
+ * Every input line is one JSON object. A search request:
+ *
+ *   {"id": "g1-m12", "fen": "<fen>", "moves": ["e2e4", "e7e5"],
+ *    "depth": 10, "movetime": 500, "nodes": 100000,
+ *    "wtime": 60000, "btime": 60000, "winc": 0, "binc": 0, "movestogo": 0}
+ *
+ * fen defaults to the starting position; with no limit at all, DEFAULT_DEPTH
+ * is searched. Requests are answered as soon as they finish, so several may
+ * be in flight and replies can arrive out of order; each reply echoes the id:
+ *
+ *   {"id": "g1-m12", "status": "ok", "bestmove": "g1f3", "ponder": "b8c6",
+ *    "score": {"cp": 31}, "depth": 10, "nodes": 81234, "time_ms": 95,
+ *    "pv": ["g1f3", "b8c6"]}
+ *
+ * The score is either {"cp": n} or {"mate": n}, from the side to move.
+ * Other commands are {"cmd": "cancel", "id": ...}, which drops a queued
+ * request or stops a running one (its reply then has status "cancelled"
+ * and the best move found so far), {"cmd": "ping"}, answered with status
+ * "pong", and {"cmd": "quit"}. A malformed request is answered with status
+ * "error" and an "error" message.
+ */
+class Daemon {
+public:
+    static constexpr int DEFAULT_DEPTH = 8;   ///< Depth searched when a request sets no limit
+
+    /**
+     * @brief Resources of the worker pool
+     */
+    struct Options {
+        int workers = 0;                                          ///< Concurrent searches (0 = one per hardware thread)
+        size_t hash_mb = TranspositionTable::DEFAULT_SIZE_MB;     ///< Transposition table size of each worker
+        int threads_per_search = 1;                               ///< Lazy SMP threads of each worker's search
+    };
+
+    /**
+     * @brief Start the worker pool with default options
+     *
+     * @param output Stream the replies are written to (must outlive the daemon)
+     */
+    explicit Daemon(std::ostream& output = std::cout);
+
+    /**
+     * @brief Start the worker pool
+     *
+     * @param output Stream the replies are written to (must outlive the daemon)
+     * @param options Pool size and per-worker resources
+     */
+    Daemon(std::ostream& output, const Options& options);
+
+    /**
+     * @brief Destructor - cancels everything still queued or running and joins the workers
+     */
+    ~Daemon();
+
+    Daemon(const Daemon&) = delete;
+    Daemon& operator=(const Daemon&) = delete;
+
+    /**
+     * @brief Read requests until "quit" or the end of the input
+     *
+     * Returns once every accepted request has been answered.
+     *
+     * @param input Stream of newline-delimited JSON requests
+     */
+    void run(std::istream& input = std::cin);
+
+    /**
+     * @brief Handle one request line
+     *
+     * Searches are queued and answered later from a worker thread; other
+     * commands are answered before this returns.
+     *
+     * @param line One JSON object
+     * @return false if the line was a quit command, true otherwise
+     */
+    bool submit(const std::string& line);
+
+    /**
+     * @brief Block until every accepted request has been answered
+     */
+    void drain();
+
+    /**
+     * @brief Get the number of worker threads
+     */
+    int worker_count() const { return static_cast<int>(workers.size()); }
+
+private:
+    /**
+     * @brief A search request waiting in the queue or running on a worker
+     */
+    struct Job {
+        std::string id;                  ///< Request id as raw JSON, echoed in the reply
+        std::string fen;
+        std::vector<std::string> moves;
+        Search::SearchLimits limits;
+        bool cancelled = false;
+    };
+
+    /**
+     * @brief One pool thread with its long-lived engine
+     */
+    struct Worker {
+        Engine engine;
+        std::thread thread;
+        std::shared_ptr<Job> job;        ///< Running request (null when idle)
+    };
+
+    std::ostream& output;
+    std::mutex output_mutex;                          ///< Serialises reply lines
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::deque<std::shared_ptr<Job>> queue;           ///< Requests not yet picked up, oldest first
+    std::mutex queue_mutex;                           ///< Guards queue, the workers' jobs, pending and shutting_down
+    std::condition_variable work_available;
+    std::condition_variable all_done;
+    int pending = 0;                                  ///< Requests accepted but not yet answered
+    bool shutting_down = false;
+
+    /**
+     * @brief Body of a worker thread: run queued requests until shutdown
+     *
+     * @param worker The worker this thread belongs to
+     */
+    void work(Worker& worker);
+
+    /**
+     * @brief Search one request on a worker's engine and write the reply
+     *
+     * @param worker Worker running the request
+     * @param job The request
+     */
+    void run_job(Worker& worker, Job& job);
+
+    /**
+     * @brief Cancel a queued or running request
+     *
+     * @param id Raw JSON id of the request
+     * @return true if the request was found
+     */
+    bool cancel(const std::string& id);
+
+    /**
+     * @brief Write one reply line
+     *
+     * @param line A complete JSON object
+     */
+    void send(const std::string& line);
+
+    /**
+     * @brief Mark one accepted request as answered
+     */
+    void finish_request();
+
+    /**
+     * @brief Build an error reply
+     *
+     * @param id Raw JSON id ("null" if unknown)
+     * @param message Error description
+     */
+    static std::string error_reply(const std::string& id, const std::string& message);
+
+    /**
+     * @brief Build the reply to a finished search
+     *
+     * @param id Raw JSON id of the request
+     * @param result Search result
+     * @param cancelled Whether the search was cancelled
+     */
+    static std::string result_reply(const std::string& id, const Search::SearchResult& result, bool cancelled);
+};
+
+#endif // DAEMON_H
@@ -1,7 +1,11 @@
 #include "Engine.h"
-#include "Search.h"
+#include "../board/MoveGenerator.h"
 
-Engine::Engine() : board(), current_position("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1") {}
+Engine::Engine() : current_position(START_FEN), board() {
+    board.set_from_fen(current_position);
+    search.set_evaluation(&evaluation);
+    search.set_persistent_history(true);
+}
 
 Engine::~Engine() = default;
 
@@ -10,20 +14,52 @@ void Engine::set_position(std::string_view fen) {
     current_position = fen;
 }
 
-std::string Engine::get_best_move(int depth) {
-    return "e2e4"; // Placeholder for the best move
-
-    // std::cout << "Searching for best move at depth " << depth << std::endl;
-    // std::cout << "Current position: " << current_position << std::endl;
-    // // Use the search algorithm to find the best move
-    // Move best_move = Search::find_best_move(board, depth);
-    //
-    // if (best_move.piece == '.') {
-    //     std::cout << "No valid move found!" << std::endl;
-    //     return "";
-    // }
-    //
-    // std::string move_string = best_move.to_algebraic();
-    // std::cout << "Best move found: " << move_string << std::endl;
-    // return move_string;
-}
\ No newline at end of file
+bool Engine::make_move(std::string_view move) {
+    Move parsed = parse_move(move);
+    if (parsed.is_null()) {
+        return false;
+    }
+    board.apply_move(parsed);
+    current_position = board.to_fen();
+    return true;
+}
+
+Move Engine::parse_move(std::string_view move) {
+    MoveGenerator generator;
+    MoveList legal_moves = generator.generate_legal_moves(board);
+    for (const Move& legal_move : legal_moves) {
+        if (legal_move.to_algebraic() == move) {
+            return legal_move;
+        }
+    }
+    return Move();
+}
+
+Search::SearchResult Engine::get_best_move(int depth) {
+    return search.search_with_stats(board, depth);
+}
+
+Search::SearchResult Engine::get_best_move_timed(std::chrono::milliseconds time_limit, int max_depth) {
+    Search::SearchLimits limits;
+    limits.move_time = time_limit;
+    limits.depth = max_depth;
+    return search.search_with_limits(board, limits);
+}
+
+Search::SearchResult Engine::get_best_move_nodes(int nodes, int max_depth) {
+    Search::SearchLimits limits;
+    limits.nodes = nodes;
+    limits.depth = max_depth;
+    return search.search_with_limits(board, limits);
+}
+
+Search::SearchResult Engine::get_best_move(const Search::SearchLimits& limits) {
+    return search.search_with_limits(board, limits);
+}
+
+void Engine::new_game() {
+    search.stop();
+    search.clear_hash();
+    search.clear_history();
+    evaluation.clear_pawn_hash_table();
+}
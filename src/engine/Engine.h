@@ -1,72 +1,155 @@
 #ifndef ENGINE_H
 #define ENGINE_H
 
+#include <chrono>
 #include <string>
 #include <string_view>
 #include "../board/Board.h"
+#include "../board/Move.h"
+#include "Evaluation.h"
+#include "Search.h"
 
 /**
  * @brief Main chess engine class
- * 
+ *
  * The Engine class provides the main interface for the chess engine,
  * handling position management and move calculation.
+ *
+ * The engine owns one Search and one Evaluation for its whole lifetime, so
+ * the transposition table, the move ordering history and the pawn hash stay
+ * warm from one set_position()/get_best_move() call to the next, as they
+ * should over the moves of a game. Call new_game() to forget them.
  */
 class Engine {
 public:
+    static constexpr const char* START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
     /**
      * @brief Default constructor
-     * 
+     *
      * Initializes the engine with the standard starting position.
      */
     Engine();
-    
+
     /**
      * @brief Destructor
      */
     ~Engine();
-    
+
+    Engine(const Engine&) = delete;
+    Engine& operator=(const Engine&) = delete;
+
     /**
      * @brief Set the board position from FEN notation
-     * 
+     *
      * Updates the internal board state using the provided FEN string.
-     * 
+     * Search state is kept, so positions of the same game profit from it.
+     *
      * @param fen FEN notation string representing the position
      */
     void set_position(std::string_view fen);
-    
+
+    /**
+     * @brief Play a move on the current position
+     *
+     * @param move Move in long algebraic (UCI) notation, e.g. "e2e4" or "e7e8q"
+     * @return true if the move was legal and played, false otherwise
+     */
+    bool make_move(std::string_view move);
+
+    /**
+     * @brief Find the legal move of the current position with the given notation
+     *
+     * @param move Move in long algebraic (UCI) notation
+     * @return The matching move, or a null move if there is none
+     */
+    Move parse_move(std::string_view move);
+
     /**
      * @brief Get the current position as FEN string
-     * 
+     *
      * Returns the current board position in FEN notation.
-     * 
+     *
      * @return Current position as FEN string
      */
     const std::string get_current_position() const { return current_position; }
-    
+
     /**
      * @brief Find the best move using search algorithm
-     * 
+     *
      * Analyzes the current position to find the best move using
      * the search algorithm with the specified depth.
-     * 
+     *
      * @param depth Search depth for move calculation
-     * @return Best move in algebraic notation
+     * @return Complete search result; best_move.to_algebraic() is the move in UCI notation
+     */
+    Search::SearchResult get_best_move(int depth);
+
+    /**
+     * @brief Find the best move within a time limit
+     *
+     * @param time_limit Time the search may use
+     * @param max_depth Deepest iteration to search (0 = no depth limit)
+     * @return Complete search result
+     */
+    Search::SearchResult get_best_move_timed(std::chrono::milliseconds time_limit, int max_depth = 0);
+
+    /**
+     * @brief Find the best move within a node budget
+     *
+     * The budget counts the nodes of the main search thread and is checked
+     * every TimeManager::NODES_BETWEEN_POLLS nodes.
+     *
+     * @param nodes Number of nodes the search may visit
+     * @param max_depth Deepest iteration to search (0 = no depth limit)
+     * @return Complete search result
+     */
+    Search::SearchResult get_best_move_nodes(int nodes, int max_depth = 0);
+
+    /**
+     * @brief Find the best move under any combination of limits
+     *
+     * @param limits Depth, time and node limits
+     * @return Complete search result
+     */
+    Search::SearchResult get_best_move(const Search::SearchLimits& limits);
+
+    /**
+     * @brief Forget the transposition table and move ordering history
+     *
+     * Call between games; the position is not changed.
      */
-    std::string get_best_move(int depth);
-    
+    void new_game();
+
+    /**
+     * @brief Get the search, e.g. to configure it or run it asynchronously
+     *
+     * @return Reference to the engine's long-lived search
+     */
+    Search& get_search() { return search; }
+
+    /**
+     * @brief Get the evaluation used by the search
+     *
+     * @return Reference to the engine's long-lived evaluation
+     */
+    Evaluation& get_evaluation() { return evaluation; }
+
     /**
      * @brief Get read-only access to the internal board
-     * 
+     *
      * Provides access to the internal board representation
      * for testing and debugging purposes.
-     * 
+     *
      * @return Const reference to the internal board
      */
     const Board& get_board() const { return board; }
-    
+
 private:
     std::string current_position;  ///< Current position in FEN notation
     Board board;                   ///< Internal chess board representation
+    Evaluation evaluation;         ///< Evaluation with its pawn hash, shared by every search
+    Search search;                 ///< Search with its transposition table and history
 };
 
-#endif // ENGINE_H
\ No newline at end of file
+#endif // ENGINE_H
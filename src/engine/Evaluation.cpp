@@ -1,9 +1,9 @@
 #include "Evaluation.h"
 #include "../board/MoveGenerator.h"
-#include <random>
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
+#include <mutex>
 
 // TODO: Add relative piece values for different positions and future prospects
 // TODO: Check if there is a need for precomputed bitboard masks: Isolated Pawn Detection, Backward Pawns, Outposts,
@@ -11,9 +11,10 @@
 // King Shield / Pawn Storm, Rook Open/Semi-Open Files, Pawn Spans and Front Spans, Pawn Spans and Front Spans, Center Control
 
 // Static member definitions
+Bitboard Evaluation::passed_pawn_masks[64][2];
 Bitboard Evaluation::isolated_pawn_masks[64];
 Bitboard Evaluation::file_masks[8];
-static bool pawn_masks_initialized = false;
+static std::once_flag pawn_masks_flag;
 
 /**
  * @brief Branchless absolute value for 32-bit integers
@@ -61,40 +62,12 @@ static Bitboard get_file_mask(int file) {
     return (file >= 0 && file < 8) ? file_masks[file] : 0ULL;
 }
 
-ZobristKeys::ZobristKeys() {
-    initialize();
-}
-
-void ZobristKeys::initialize() {
-    std::mt19937_64 rng(0x1234567890ABCDEF); // Fixed seed for reproducibility
-    std::uniform_int_distribution<uint64_t> dist;
-    
-    // Initialize piece keys
-    for (int color = 0; color < 2; ++color) {
-        for (int piece = 0; piece < 6; ++piece) {
-            for (int square = 0; square < 64; ++square) {
-                piece_keys[color][piece][square] = dist(rng);
-            }
-        }
-    }
-    
-    // Initialize castling keys
-    for (int i = 0; i < 16; ++i) {
-        castling_keys[i] = dist(rng);
-    }
-    
-    // Initialize en passant keys
-    for (int i = 0; i < 8; ++i) {
-        en_passant_keys[i] = dist(rng);
-    }
-    
-    // Initialize side to move key
-    side_to_move_key = dist(rng);
-}
-
 Evaluation::Evaluation() {
-    pawn_hash_table.reserve(65536); // Reserve space for pawn hash table
-    init_pawn_masks(); // Initialize other pawn masks
+    pawn_hash_table.resize(PAWN_HASH_SIZE); // Fixed-size pawn hash table, never grows during search
+    clear_pawn_hash_table();
+    // Evaluations are created on several threads at once (search helpers,
+    // batch workers, C API handles); the shared masks are filled only once
+    std::call_once(pawn_masks_flag, init_pawn_masks);
 }
 
 // TODO: Tune constants and piece-square tables for better representation of piece values and positions
@@ -245,14 +218,13 @@ void Evaluation::initialize_incremental_eval(const Board& board) {
 
 // Update incremental evaluation
 void Evaluation::update_incremental_eval(const Board& board, const Move& move, const BitboardMoveUndoData& undo_data) {
-    // Bounds checking for move parameters
-    if (move.from_rank < 0 || move.from_rank >= 8 || move.from_file < 0 || move.from_file >= 8 ||
-        move.to_rank < 0 || move.to_rank >= 8 || move.to_file < 0 || move.to_file >= 8) {
+    // Packed moves always hold on-board squares; only reject empty moves
+    if (!move.is_valid()) {
         return; // Invalid move, skip update
     }
     
-    Board::PieceType piece_type = Board::char_to_piece_type(move.piece);
-    Board::Color piece_color = Board::char_to_color(move.piece);
+    Board::PieceType piece_type = static_cast<Board::PieceType>(move.piece_type());
+    Board::Color piece_color = static_cast<Board::Color>(move.piece_color());
     
     // Validate piece type and color
     if (piece_type < 0 || piece_type >= 6 || piece_color < 0 || piece_color >= 2) {
@@ -261,8 +233,8 @@ void Evaluation::update_incremental_eval(const Board& board, const Move& move, c
     
     int side_multiplier = side_sign(piece_color);
     
-    int from_square = square_to_index(move.from_rank, move.from_file);
-    int to_square = square_to_index(move.to_rank, move.to_file);
+    int from_square = move.from_square();
+    int to_square = move.to_square();
     
     // Additional bounds checking for calculated squares
     if (from_square < 0 || from_square >= 64 || to_square < 0 || to_square >= 64) {
@@ -270,8 +242,8 @@ void Evaluation::update_incremental_eval(const Board& board, const Move& move, c
     }
     
     // Update material balance if there was a capture
-    if (move.captured_piece != '.') {
-        Board::PieceType captured_type = Board::char_to_piece_type(move.captured_piece);
+    if (move.is_capture()) {
+        Board::PieceType captured_type = static_cast<Board::PieceType>(move.captured_type());
         incremental_data.material_balance -= side_multiplier * MATERIAL_VALUES[captured_type];
         incremental_data.phase_value -= PHASE_VALUES[captured_type];
     }
@@ -282,8 +254,8 @@ void Evaluation::update_incremental_eval(const Board& board, const Move& move, c
     incremental_data.positional_balance += side_multiplier * (new_pst_value - old_pst_value);
     
     // Handle promotion
-    if (move.promotion_piece != '.') {
-        Board::PieceType promotion_type = Board::char_to_piece_type(move.promotion_piece);
+    if (move.is_promotion()) {
+        Board::PieceType promotion_type = static_cast<Board::PieceType>(move.promotion_type());
         // Remove pawn value, add promoted piece value
         incremental_data.material_balance += side_multiplier * (MATERIAL_VALUES[promotion_type] - MATERIAL_VALUES[Board::PAWN]);
         incremental_data.phase_value += PHASE_VALUES[promotion_type];
@@ -300,7 +272,7 @@ void Evaluation::update_incremental_eval(const Board& board, const Move& move, c
 
     // Update pawn structure score incrementally
     // For pawn moves, captures involving pawns, or promotions, we need to recalculate affected areas
-    if (piece_type == Board::PAWN || move.captured_piece == 'P' || move.captured_piece == 'p' || move.promotion_piece != '.') {
+    if (piece_type == Board::PAWN || move.captured_type() == Board::PAWN || move.is_promotion()) {
         // Calculate old pawn structure scores
         int old_white_pawn_score = 0;
         int old_black_pawn_score = 0;
@@ -324,7 +296,7 @@ void Evaluation::update_incremental_eval(const Board& board, const Move& move, c
     int white_king_pos = board.get_king_position(Board::WHITE);
     int black_king_pos = board.get_king_position(Board::BLACK);
     if (piece_type == Board::KING || 
-        move.captured_piece != '.' ||
+        move.is_capture() ||
         (piece_type == Board::ROOK && (from_square == 0 || from_square == 7 || from_square == 56 || from_square == 63)) ||
         abs_int(to_square - white_king_pos) <= 16 || abs_int(to_square - black_king_pos) <= 16 ||
         abs_int(from_square - white_king_pos) <= 16 || abs_int(from_square - black_king_pos) <= 16) {
@@ -337,7 +309,7 @@ void Evaluation::update_incremental_eval(const Board& board, const Move& move, c
     // 1. Any piece moves (changes its own mobility)
     // 2. Pieces are captured (affects mobility of other pieces)
     // 3. Pieces block/unblock other pieces' mobility
-    if (move.captured_piece != '.' || 
+    if (move.is_capture() || 
         piece_type == Board::KNIGHT || piece_type == Board::BISHOP || 
         piece_type == Board::ROOK || piece_type == Board::QUEEN) {
         // For pieces that significantly affect mobility, recalculate
@@ -354,7 +326,7 @@ void Evaluation::update_incremental_eval(const Board& board, const Move& move, c
     }
     
     // En passant capture
-    if (piece_type == Board::PAWN && move.captured_piece == '.' && 
+    if (piece_type == Board::PAWN && !move.is_capture() && 
         abs_int(to_square - from_square) != 8 && abs_int(to_square - from_square) != 16) {
         // En passant affects pawn structure
         incremental_data.pawn_structure_score = 0;
@@ -404,14 +376,13 @@ These should trigger updates to those evaluation components, as your code shows.
 
 // Undo incremental evaluation
 void Evaluation::undo_incremental_eval(const Board& board, const Move& move, const BitboardMoveUndoData& undo_data) {
-    // Bounds checking for move parameters
-    if (move.from_rank < 0 || move.from_rank >= 8 || move.from_file < 0 || move.from_file >= 8 ||
-        move.to_rank < 0 || move.to_rank >= 8 || move.to_file < 0 || move.to_file >= 8) {
+    // Packed moves always hold on-board squares; only reject empty moves
+    if (!move.is_valid()) {
         return; // Invalid move, skip undo
     }
     
-    Board::PieceType piece_type = Board::char_to_piece_type(move.piece);
-    Board::Color piece_color = Board::char_to_color(move.piece);
+    Board::PieceType piece_type = static_cast<Board::PieceType>(move.piece_type());
+    Board::Color piece_color = static_cast<Board::Color>(move.piece_color());
     
     // Validate piece type and color
     if (piece_type < 0 || piece_type >= 6 || piece_color < 0 || piece_color >= 2) {
@@ -420,8 +391,8 @@ void Evaluation::undo_incremental_eval(const Board& board, const Move& move, con
     
     int side_multiplier = side_sign(piece_color);
     
-    int from_square = square_to_index(move.from_rank, move.from_file);
-    int to_square = square_to_index(move.to_rank, move.to_file);
+    int from_square = move.from_square();
+    int to_square = move.to_square();
     
     // Additional bounds checking for calculated squares
     if (from_square < 0 || from_square >= 64 || to_square < 0 || to_square >= 64) {
@@ -429,8 +400,8 @@ void Evaluation::undo_incremental_eval(const Board& board, const Move& move, con
     }
     
     // Undo material balance changes
-    if (move.captured_piece != '.') {
-        Board::PieceType captured_type = Board::char_to_piece_type(move.captured_piece);
+    if (move.is_capture()) {
+        Board::PieceType captured_type = static_cast<Board::PieceType>(move.captured_type());
         incremental_data.material_balance += side_multiplier * MATERIAL_VALUES[captured_type];
         incremental_data.phase_value += PHASE_VALUES[captured_type];
     }
@@ -441,8 +412,8 @@ void Evaluation::undo_incremental_eval(const Board& board, const Move& move, con
     incremental_data.positional_balance -= side_multiplier * (new_pst_value - old_pst_value);
     
     // Undo promotion
-    if (move.promotion_piece != '.') {
-        Board::PieceType promotion_type = Board::char_to_piece_type(move.promotion_piece);
+    if (move.is_promotion()) {
+        Board::PieceType promotion_type = static_cast<Board::PieceType>(move.promotion_type());
         incremental_data.material_balance -= side_multiplier * (MATERIAL_VALUES[promotion_type] - MATERIAL_VALUES[Board::PAWN]);
         incremental_data.phase_value -= PHASE_VALUES[promotion_type];
         
@@ -457,7 +428,7 @@ void Evaluation::undo_incremental_eval(const Board& board, const Move& move, con
     
     // Mark components for recalculation when undoing moves that affect them
     // Undo pawn structure score incrementally
-    if (piece_type == Board::PAWN || move.captured_piece == 'P' || move.captured_piece == 'p' || move.promotion_piece != '.') {
+    if (piece_type == Board::PAWN || move.captured_type() == Board::PAWN || move.is_promotion()) {
         incremental_data.pawn_structure_score = 0; // Will be recalculated in next evaluation
     }
     
@@ -465,7 +436,7 @@ void Evaluation::undo_incremental_eval(const Board& board, const Move& move, con
     int white_king_pos = board.get_king_position(Board::WHITE);
     int black_king_pos = board.get_king_position(Board::BLACK);
     if (piece_type == Board::KING || 
-        move.captured_piece != '.' ||
+        move.is_capture() ||
         (piece_type == Board::ROOK && (from_square == 0 || from_square == 7 || from_square == 56 || from_square == 63)) ||
         abs_int(to_square - white_king_pos) <= 16 || abs_int(to_square - black_king_pos) <= 16 ||
         abs_int(from_square - white_king_pos) <= 16 || abs_int(from_square - black_king_pos) <= 16) {
@@ -473,7 +444,7 @@ void Evaluation::undo_incremental_eval(const Board& board, const Move& move, con
     }
     
     // Undo mobility score incrementally
-    if (move.captured_piece != '.' || 
+    if (move.is_capture() || 
         piece_type == Board::KNIGHT || piece_type == Board::BISHOP || 
         piece_type == Board::ROOK || piece_type == Board::QUEEN) {
         incremental_data.mobility_score = 0; // Will be recalculated in next evaluation
@@ -487,7 +458,7 @@ void Evaluation::undo_incremental_eval(const Board& board, const Move& move, con
     }
     
     // En passant capture
-    if (piece_type == Board::PAWN && move.captured_piece == '.' && 
+    if (piece_type == Board::PAWN && !move.is_capture() && 
         abs_int(to_square - from_square) != 8 && abs_int(to_square - from_square) != 16) {
         incremental_data.pawn_structure_score = 0;
     }
@@ -495,76 +466,49 @@ void Evaluation::undo_incremental_eval(const Board& board, const Move& move, con
 
 // Zobrist hashing
 uint64_t Evaluation::compute_zobrist_hash(const Board& board) const {
-    uint64_t hash = 0;
-    
-    // Hash all pieces
-    for (int square = 0; square < 64; ++square) {
-        int rank = square / 8;
-        int file = square % 8;
-        char piece = board.get_piece(rank, file);
-        
-        if (piece != '.') {
-            Board::PieceType piece_type = Board::char_to_piece_type(piece);
-            Board::Color color = Board::char_to_color(piece);
-            hash ^= zobrist_keys.piece_keys[color][piece_type][square];
-        }
-    }
-    
-    // Hash castling rights
-    hash ^= zobrist_keys.castling_keys[board.get_castling_rights()];
-    
-    // Hash en passant
-    if (board.get_en_passant_file() != -1) {
-        hash ^= zobrist_keys.en_passant_keys[board.get_en_passant_file()];
-    }
-    
-    // Hash side to move
-    if (board.get_active_color() == Board::BLACK) {
-        hash ^= zobrist_keys.side_to_move_key;
-    }
-    
-    return hash;
+    // The key tables live in the board layer; this is the full recomputation
+    return board.compute_hash_key();
 }
 
 // Update Zobrist hash incrementally
 uint64_t Evaluation::update_zobrist_hash(uint64_t current_hash, const Move& move, const BitboardMoveUndoData& undo_data) const {
     uint64_t hash = current_hash;
     
-    Board::PieceType piece_type = Board::char_to_piece_type(move.piece);
-    Board::Color piece_color = Board::char_to_color(move.piece);
+    Board::PieceType piece_type = static_cast<Board::PieceType>(move.piece_type());
+    Board::Color piece_color = static_cast<Board::Color>(move.piece_color());
     
-    int from_square = square_to_index(move.from_rank, move.from_file);
-    int to_square = square_to_index(move.to_rank, move.to_file);
+    int from_square = move.from_square();
+    int to_square = move.to_square();
     
     // Remove piece from source square
-    hash ^= zobrist_keys.piece_keys[piece_color][piece_type][from_square];
+    hash ^= Zobrist::piece_key(piece_color, piece_type, from_square);
     
     // Add piece to destination square
-    if (move.promotion_piece != '.') {
-        Board::PieceType promotion_type = Board::char_to_piece_type(move.promotion_piece);
-        hash ^= zobrist_keys.piece_keys[piece_color][promotion_type][to_square];
+    if (move.is_promotion()) {
+        Board::PieceType promotion_type = static_cast<Board::PieceType>(move.promotion_type());
+        hash ^= Zobrist::piece_key(piece_color, promotion_type, to_square);
     } else {
-        hash ^= zobrist_keys.piece_keys[piece_color][piece_type][to_square];
+        hash ^= Zobrist::piece_key(piece_color, piece_type, to_square);
     }
     
     // Remove captured piece
-    if (move.captured_piece != '.') {
-        Board::PieceType captured_type = Board::char_to_piece_type(move.captured_piece);
-        Board::Color captured_color = Board::char_to_color(move.captured_piece);
-        hash ^= zobrist_keys.piece_keys[captured_color][captured_type][to_square];
+    if (move.is_capture()) {
+        Board::PieceType captured_type = static_cast<Board::PieceType>(move.captured_type());
+        Board::Color captured_color = (piece_color == Board::WHITE) ? Board::BLACK : Board::WHITE;
+        hash ^= Zobrist::piece_key(captured_color, captured_type, to_square);
     }
     
     // Update castling rights
-    hash ^= zobrist_keys.castling_keys[undo_data.castling_rights];
+    hash ^= Zobrist::castling_key(undo_data.castling_rights);
     // Note: New castling rights would be XORed in by the caller
     
     // Update en passant
     if (undo_data.en_passant_file != -1) {
-        hash ^= zobrist_keys.en_passant_keys[undo_data.en_passant_file];
+        hash ^= Zobrist::en_passant_key(undo_data.en_passant_file);
     }
     
     // Toggle side to move
-    hash ^= zobrist_keys.side_to_move_key;
+    hash ^= Zobrist::side_to_move_key();
     
     return hash;
 }
@@ -637,18 +581,11 @@ int Evaluation::get_piece_square_value(Board::PieceType piece_type, Board::Color
 
 // Pawn structure evaluation
 int Evaluation::evaluate_pawn_structure(const Board& board) {
-    // Try to get from pawn hash table first
-    uint64_t pawn_hash = 0;
-    
-    // Calculate pawn hash (simplified - just XOR pawn positions)
-    for (int color = 0; color < 2; ++color) {
-        Bitboard pawns = board.get_piece_bitboard(Board::PAWN, static_cast<Board::Color>(color));
-        pawn_hash ^= pawns << color;
-    }
-    
-    auto it = pawn_hash_table.find(pawn_hash);
-    if (it != pawn_hash_table.end()) {
-        return it->second.score;
+    // Try to get from pawn hash table first, keyed by the board's incremental pawn key
+    uint64_t pawn_hash = board.get_pawn_key();
+    PawnHashEntry& entry = pawn_hash_table[pawn_hash & (PAWN_HASH_SIZE - 1)];
+    if (entry.key == pawn_hash) {
+        return entry.score;
     }
     
     // Calculate pawn structure score
@@ -656,11 +593,9 @@ int Evaluation::evaluate_pawn_structure(const Board& board) {
     score += evaluate_pawn_structure_for_color(board, Board::WHITE);
     score -= evaluate_pawn_structure_for_color(board, Board::BLACK);
 
-    // Store in pawn hash table
-    PawnHashEntry entry;
+    // Store in pawn hash table (always replace)
     entry.key = pawn_hash;
     entry.score = score;
-    pawn_hash_table[pawn_hash] = entry;
     
     return score;
 }
@@ -1941,7 +1876,10 @@ int Evaluation::get_phase_value(const Board& board) const {
 }
 
 void Evaluation::clear_pawn_hash_table() {
-    pawn_hash_table.clear();
+    // An all-ones key marks an empty slot
+    PawnHashEntry empty;
+    empty.key = ~0ULL;
+    std::fill(pawn_hash_table.begin(), pawn_hash_table.end(), empty);
 }
 
 void Evaluation::print_evaluation_breakdown(const Board& board) {
@@ -1998,8 +1936,6 @@ void Evaluation::print_evaluation_breakdown(const Board& board) {
  * for both colors on all squares. Called once during initialization.
  */
 void Evaluation::init_passed_pawn_masks() {
-    if (pawn_masks_initialized) return;
-    
     for (int sq = 0; sq < 64; ++sq) {
         int file = sq & 7;
         int rank = sq >> 3;
@@ -2023,8 +1959,6 @@ void Evaluation::init_passed_pawn_masks() {
 }
 
 void Evaluation::init_pawn_masks() {
-    if (pawn_masks_initialized) return;
-    
     init_passed_pawn_masks(); // Initialize passed pawn masks
     // Initialize file masks
     for (int file = 0; file < 8; ++file) {
@@ -2049,8 +1983,6 @@ void Evaluation::init_pawn_masks() {
             isolated_pawn_masks[square] |= file_masks[file + 1];
         }
     }
-    
-    pawn_masks_initialized = true;
 }
 
 bool Evaluation::is_passed_pawn(const Board& board, int square, Board::Color color) const {
@@ -4,7 +4,7 @@
 #include "../board/Board.h"
 #include "../board/Move.h"
 #include <cstdint>
-#include <unordered_map>
+#include <vector>
 
 // Forward declarations
 struct BitboardMoveUndoData;
@@ -130,30 +130,6 @@ struct IncrementalEvalData {
                            mobility_score(0), game_phase(OPENING), phase_value(0) {}
 };
 
-/**
- * @struct ZobristKeys
- * @brief Zobrist hashing keys for position hashing and transposition tables
- * 
- * Contains precomputed random keys for all chess position components
- * to enable fast position hashing for transposition tables and repetition detection.
- */
-struct ZobristKeys {
-    uint64_t piece_keys[2][6][64];  ///< Keys for pieces: [color][piece_type][square]
-    uint64_t castling_keys[16];     ///< Keys for all castling right combinations
-    uint64_t en_passant_keys[8];    ///< Keys for en passant target files
-    uint64_t side_to_move_key;      ///< Key for side to move
-    
-    /**
-     * @brief Constructor - calls initialize()
-     */
-    ZobristKeys();
-    
-    /**
-     * @brief Initializes all Zobrist keys with random values
-     */
-    void initialize();
-};
-
 /**
  * @struct PawnHashEntry
  * @brief Hash table entry for caching pawn structure evaluations
@@ -680,11 +656,11 @@ private:
     
     // Member variables
     IncrementalEvalData incremental_data;
-    ZobristKeys zobrist_keys;
-    std::unordered_map<uint64_t, PawnHashEntry> pawn_hash_table;
+    std::vector<PawnHashEntry> pawn_hash_table; // Direct-mapped, allocated once in the constructor
+    static constexpr size_t PAWN_HASH_SIZE = 65536; // Must be a power of two
     
     // Precomputed masks for efficient pawn evaluation
-    Bitboard passed_pawn_masks[64][2]; // [square][color]
+    static Bitboard passed_pawn_masks[64][2];  // [square][color]
     static Bitboard isolated_pawn_masks[64];   // [square] - adjacent files
     static Bitboard file_masks[8];             // [file] - entire file
     
@@ -859,12 +835,12 @@ private:
     /**
      * @brief Initializes passed pawn masks for efficient evaluation
      */
-    void init_passed_pawn_masks();
+    static void init_passed_pawn_masks();
     
     /**
      * @brief Initializes pawn-related bitboard masks
      */
-    void init_pawn_masks();
+    static void init_pawn_masks();
     
     /**
      * @brief Returns evaluation sign multiplier for a color
@@ -0,0 +1,65 @@
+#include "MoveHistory.h"
+#include <algorithm>
+#include <cstdlib>
+
+void MoveHistory::clear() {
+    for (auto& killers : killer_moves) {
+        killers[0] = Move();
+        killers[1] = Move();
+    }
+    for (auto& by_from : butterfly) {
+        for (auto& by_to : by_from) {
+            std::fill(std::begin(by_to), std::end(by_to), 0);
+        }
+    }
+    for (auto& by_piece : countermoves) {
+        for (auto& by_square : by_piece) {
+            std::fill(std::begin(by_square), std::end(by_square), Move());
+        }
+    }
+}
+
+void MoveHistory::age() {
+    for (auto& killers : killer_moves) {
+        killers[0] = Move();
+        killers[1] = Move();
+    }
+    for (auto& by_from : butterfly) {
+        for (auto& by_to : by_from) {
+            for (int& entry : by_to) {
+                entry /= 2;
+            }
+        }
+    }
+}
+
+Move MoveHistory::countermove(const Move& previous_move) const {
+    if (previous_move.is_null()) {
+        return Move();
+    }
+    return countermoves[previous_move.piece_color()][previous_move.piece_type()][previous_move.to_square()];
+}
+
+void MoveHistory::update_quiet_cutoff(Board::Color color, const Move& move, const Move& previous_move,
+                                      int ply, int depth, const Move* quiets_tried, int quiet_count) {
+    if (ply < MAX_PLY && killer_moves[ply][0] != move) {
+        killer_moves[ply][1] = killer_moves[ply][0];
+        killer_moves[ply][0] = move;
+    }
+
+    if (!previous_move.is_null()) {
+        countermoves[previous_move.piece_color()][previous_move.piece_type()][previous_move.to_square()] = move;
+    }
+
+    // Deeper cutoffs are more trustworthy, so they move the scores further
+    int bonus = depth * depth;
+    apply_bonus(butterfly[color][move.from_square()][move.to_square()], bonus);
+    for (int i = 0; i < quiet_count; ++i) {
+        apply_bonus(butterfly[color][quiets_tried[i].from_square()][quiets_tried[i].to_square()], -bonus);
+    }
+}
+
+void MoveHistory::apply_bonus(int& entry, int bonus) {
+    bonus = std::clamp(bonus, -HISTORY_MAX, HISTORY_MAX);
+    entry += bonus - entry * std::abs(bonus) / HISTORY_MAX;
+}
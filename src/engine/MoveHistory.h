@@ -0,0 +1,107 @@
+#ifndef MOVEHISTORY_H
+#define MOVEHISTORY_H
+
+#include "../board/Board.h"
+#include "../board/Move.h"
+
+/**
+ * @brief Quiet move ordering statistics gathered while searching
+ *
+ * Holds the three classic heuristics for ordering quiet moves, all of them
+ * filled from beta cutoffs:
+ *
+ *   - killer moves: the last two quiet moves that caused a cutoff at each ply
+ *   - butterfly history: a score per [color][from][to], raised for the quiet
+ *     move that cut off and lowered for the quiet moves tried before it
+ *   - countermoves: the quiet move that last refuted a given previous move,
+ *     indexed by the color, piece and destination of that previous move
+ *
+ * History updates use gravity (each update is scaled by how far the entry
+ * already is from zero), so scores stay within +-HISTORY_MAX and recent
+ * results outweigh old ones.
+ *
+ * Everything survives between iterations of one search. Between searches of
+ * the same game, age() keeps the tables but halves the history scores.
+ */
+class MoveHistory {
+public:
+    static constexpr int MAX_PLY = 64;
+    static constexpr int HISTORY_MAX = 8192;  ///< Bound on history scores (below every capture score)
+
+    /**
+     * @brief Construct empty tables
+     */
+    MoveHistory() { clear(); }
+
+    /**
+     * @brief Forget everything (e.g. before a new game)
+     */
+    void clear();
+
+    /**
+     * @brief Prepare the tables for the next search of the same game
+     *
+     * Killers are cleared since plies now count from a different root,
+     * history scores are halved and countermoves are kept.
+     */
+    void age();
+
+    /**
+     * @brief Get the two killer moves of a ply
+     *
+     * @param ply Distance from the root in half-moves
+     * @return Pointer to two moves (null moves if unset), or nullptr past MAX_PLY
+     */
+    const Move* killers(int ply) const { return ply < MAX_PLY ? killer_moves[ply] : nullptr; }
+
+    /**
+     * @brief Get the butterfly history score of a quiet move
+     *
+     * @param color Side making the move
+     * @param move The move
+     * @return Score in [-HISTORY_MAX, HISTORY_MAX]
+     */
+    int history_score(Board::Color color, const Move& move) const {
+        return butterfly[color][move.from_square()][move.to_square()];
+    }
+
+    /**
+     * @brief Get the countermove stored for a previous move
+     *
+     * @param previous_move The opponent's last move (null move if none)
+     * @return The stored reply, or a null move
+     */
+    Move countermove(const Move& previous_move) const;
+
+    /**
+     * @brief Record a beta cutoff by a quiet move
+     *
+     * Stores the move as killer and countermove, rewards it in the history
+     * table and penalises the quiet moves that were searched before it.
+     *
+     * @param color Side that made the cutoff move
+     * @param move The quiet move that caused the cutoff
+     * @param previous_move The opponent's move leading to this node (null move if none)
+     * @param ply Distance from the root in half-moves
+     * @param depth Remaining depth of the node
+     * @param quiets_tried Quiet moves searched before the cutoff move
+     * @param quiet_count Number of entries in quiets_tried
+     */
+    void update_quiet_cutoff(Board::Color color, const Move& move, const Move& previous_move,
+                             int ply, int depth, const Move* quiets_tried, int quiet_count);
+
+private:
+    Move killer_moves[MAX_PLY][2];
+    int butterfly[Board::NUM_COLORS][64][64];
+    Move countermoves[Board::NUM_COLORS][Board::NUM_PIECE_TYPES][64];
+
+    /**
+     * @brief Move a history entry towards +-HISTORY_MAX by a bonus with gravity
+     *
+     * @param entry Entry to update
+     * @param bonus Signed bonus, clamped to +-HISTORY_MAX
+     */
+    static void apply_bonus(int& entry, int bonus);
+};
+
+#endif // MOVEHISTORY_H
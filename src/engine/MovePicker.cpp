@@ -0,0 +1,188 @@
+#include "MovePicker.h"
+#include <utility>
+
+MovePicker::MovePicker(const Board& board, MoveGenerator& generator, Move hash_move, const Move* killers,
+                       Move countermove, const MoveHistory* history)
+    : board(board), move_generator(generator), hash_move(hash_move), history(history),
+      in_check(board.is_in_check(board.get_active_color())) {
+    // Killers only make sense as quiet moves outside of check; anything else
+    // is dropped here so the capture and evasion stages never skip it
+    for (int i = 0; i < 2; ++i) {
+        Move killer = killers ? killers[i] : Move();
+        bool usable = !in_check && !killer.is_null() && killer != hash_move &&
+                      !killer.is_capture() && !killer.is_promotion();
+        killer_moves[i] = usable ? killer : Move();
+    }
+    if (killer_moves[1] == killer_moves[0]) {
+        killer_moves[1] = Move();
+    }
+    bool usable = !in_check && !countermove.is_null() && countermove != hash_move &&
+                  countermove != killer_moves[0] && countermove != killer_moves[1] &&
+                  !countermove.is_capture() && !countermove.is_promotion();
+    this->countermove = usable ? countermove : Move();
+
+    if (!hash_move.is_null() && board.is_move_legal(hash_move)) {
+        stage = HASH_MOVE;
+    } else {
+        this->hash_move = Move();
+        stage = in_check ? GENERATE_EVASIONS : GENERATE_CAPTURES;
+    }
+}
+
+MovePicker::MovePicker(const Board& board, MoveGenerator& generator)
+    : board(board), move_generator(generator), hash_move(),
+      in_check(board.is_in_check(board.get_active_color())), captures_only(true) {
+    stage = in_check ? GENERATE_EVASIONS : GENERATE_CAPTURES;
+}
+
+Move MovePicker::next_move() {
+    while (true) {
+        switch (stage) {
+            case HASH_MOVE:
+                stage = in_check ? GENERATE_EVASIONS : GENERATE_CAPTURES;
+                return hash_move;
+
+            case GENERATE_CAPTURES:
+                moves.clear();
+                move_generator.generate_captures(board, moves);
+                move_generator.generate_promotions(board, moves);
+                score_moves();
+                stage = GOOD_CAPTURES;
+                break;
+
+            case GOOD_CAPTURES:
+                while (current < moves.size()) {
+                    Move move = pick_best();
+                    if (already_tried(move)) {
+                        continue;
+                    }
+                    // Captures that lose material wait until after the killers
+                    if (!move_generator.see_ge(board, move, 0)) {
+                        bad_captures.push_back(move);
+                        continue;
+                    }
+                    if (board.is_move_legal(move)) {
+                        return move;
+                    }
+                }
+                stage = captures_only ? DONE : FIRST_KILLER;
+                break;
+
+            case FIRST_KILLER:
+                stage = SECOND_KILLER;
+                if (is_legal_refutation(killer_moves[0])) {
+                    return killer_moves[0];
+                }
+                break;
+
+            case SECOND_KILLER:
+                stage = COUNTERMOVE;
+                if (is_legal_refutation(killer_moves[1])) {
+                    return killer_moves[1];
+                }
+                break;
+
+            case COUNTERMOVE:
+                stage = BAD_CAPTURES;
+                if (is_legal_refutation(countermove)) {
+                    return countermove;
+                }
+                break;
+
+            case BAD_CAPTURES:
+                while (current_bad < bad_captures.size()) {
+                    Move move = bad_captures[current_bad++];
+                    if (board.is_move_legal(move)) {
+                        return move;
+                    }
+                }
+                stage = GENERATE_QUIETS;
+                break;
+
+            case GENERATE_QUIETS:
+                moves.clear();
+                move_generator.generate_quiet_moves(board, moves);
+                score_moves();
+                stage = QUIETS;
+                break;
+
+            case QUIETS:
+                // Promotions were already returned with the captures
+                while (current < moves.size()) {
+                    Move move = pick_best();
+                    if (!move.is_promotion() && !already_tried(move) && board.is_move_legal(move)) {
+                        return move;
+                    }
+                }
+                stage = DONE;
+                break;
+
+            case GENERATE_EVASIONS:
+                moves = move_generator.generate_evasions(board);
+                score_moves();
+                stage = EVASIONS;
+                break;
+
+            case EVASIONS:
+                // Evasions are legal by construction
+                while (current < moves.size()) {
+                    Move move = pick_best();
+                    if (!already_tried(move)) {
+                        return move;
+                    }
+                }
+                stage = DONE;
+                break;
+
+            case DONE:
+                return Move();
+        }
+    }
+}
+
+void MovePicker::score_moves() {
+    current = 0;
+    for (size_t i = 0; i < moves.size(); ++i) {
+        const Move& move = moves[i];
+        int score = 0;
+
+        // MVV-LVA: Most Valuable Victim - Least Valuable Attacker, ahead of every quiet move
+        if (move.is_capture()) {
+            score += PIECE_VALUES[Board::KING] + PIECE_VALUES[move.captured_type()] -
+                     PIECE_VALUES[move.piece_type()] / 10;
+        }
+
+        if (move.is_promotion()) {
+            score += PROMOTION_BONUS;
+        }
+
+        // Quiet moves are ranked by how often they caused cutoffs elsewhere
+        if (!move.is_capture() && !move.is_promotion() && history) {
+            score += history->history_score(board.get_active_color(), move);
+        }
+
+        scores[i] = score;
+    }
+}
+
+Move MovePicker::pick_best() {
+    // Selection sort step: only as much of the list is ordered as is consumed
+    size_t best = current;
+    for (size_t i = current + 1; i < moves.size(); ++i) {
+        if (scores[i] > scores[best]) {
+            best = i;
+        }
+    }
+
+    std::swap(moves[current], moves[best]);
+    std::swap(scores[current], scores[best]);
+    return moves[current++];
+}
+
+bool MovePicker::already_tried(const Move& move) const {
+    return move == hash_move || move == killer_moves[0] || move == killer_moves[1] || move == countermove;
+}
+
+bool MovePicker::is_legal_refutation(const Move& move) const {
+    return !move.is_null() && board.is_move_legal(move);
+}
@@ -0,0 +1,142 @@
+#ifndef MOVEPICKER_H
+#define MOVEPICKER_H
+
+#include "../board/Board.h"
+#include "../board/Move.h"
+#include "../board/MoveGenerator.h"
+#include "MoveHistory.h"
+#include <array>
+
+/**
+ * @brief Staged, lazy move picker for the search
+ *
+ * Hands out the legal moves of a position one at a time, best guess first,
+ * generating each group of moves only when the previous group is exhausted:
+ *
+ *   1. the hash move, verified without generating anything
+ *   2. captures and promotions that do not lose material, scored once by
+ *      MVV-LVA and checked with static exchange evaluation as they come up
+ *   3. the killer moves of the current ply and the countermove to the
+ *      opponent's last move
+ *   4. the captures that lose material according to SEE
+ *   5. the remaining quiet moves, ordered by their butterfly history score
+ *
+ * Losing captures go ahead of the quiet moves rather than after them: the
+ * search reduces and prunes late quiet moves but never captures, so putting
+ * the captures last only pushes the quiets up and costs nodes.
+ *
+ * The quiescence constructor stops after stage 2, so losing captures are
+ * never searched there.
+ *
+ * When a beta cutoff happens on an early move the search simply stops asking,
+ * so the later stages are never generated. In check, the hash move is followed
+ * by a single stage of evasions from MoveGenerator::generate_evasions.
+ *
+ * Moves already handed out by an earlier stage are skipped in the later ones,
+ * and pseudo-legal moves are verified with Board::is_move_legal only when they
+ * are about to be returned.
+ */
+class MovePicker {
+public:
+    /**
+     * @brief Construct a picker for the given position
+     *
+     * @param board The position to pick moves for (must outlive the picker)
+     * @param generator Move generator used to fill the stages
+     * @param hash_move Move to try first (null move if none)
+     * @param killers Pointer to the two killer moves of this ply, or nullptr
+     * @param countermove Quiet reply that last refuted the opponent's move (null move if none)
+     * @param history History table used to order quiet moves, or nullptr
+     */
+    MovePicker(const Board& board, MoveGenerator& generator, Move hash_move, const Move* killers = nullptr,
+               Move countermove = Move(), const MoveHistory* history = nullptr);
+
+    /**
+     * @brief Construct a quiescence picker (captures and promotions only)
+     *
+     * Captures that lose material according to SEE are not returned.
+     * When the side to move is in check, every evasion is returned instead.
+     *
+     * @param board The position to pick moves for (must outlive the picker)
+     * @param generator Move generator used to fill the stages
+     */
+    MovePicker(const Board& board, MoveGenerator& generator);
+
+    /**
+     * @brief Get the next move to search
+     *
+     * @return The next legal move, or a null move once every stage is exhausted
+     */
+    Move next_move();
+
+private:
+    /**
+     * @brief Stages of the picker, in the order they are visited
+     */
+    enum Stage {
+        HASH_MOVE,
+        GENERATE_CAPTURES,
+        GOOD_CAPTURES,
+        FIRST_KILLER,
+        SECOND_KILLER,
+        COUNTERMOVE,
+        BAD_CAPTURES,
+        GENERATE_QUIETS,
+        QUIETS,
+        GENERATE_EVASIONS,
+        EVASIONS,
+        DONE
+    };
+
+    // Ordering scores; captures are also ranked among themselves by MVV-LVA
+    static constexpr int PROMOTION_BONUS = 800;
+    static constexpr int PIECE_VALUES[6] = {100, 300, 300, 500, 900, 10000};
+
+    const Board& board;
+    MoveGenerator& move_generator;
+    Move hash_move;
+    Move killer_moves[2];
+    Move countermove;
+    const MoveHistory* history = nullptr;
+    bool in_check;
+    bool captures_only = false;
+    Stage stage;
+
+    MoveList moves;                                ///< Moves of the current stage
+    std::array<int, MoveList::MAX_MOVES> scores;   ///< Score of each entry in moves
+    size_t current = 0;                            ///< Next unpicked entry in moves
+    MoveList bad_captures;                         ///< Captures deferred by SEE, in MVV-LVA order
+    size_t current_bad = 0;                        ///< Next unreturned entry in bad_captures
+
+    /**
+     * @brief Score every entry of the current stage once
+     */
+    void score_moves();
+
+    /**
+     * @brief Swap the best remaining move to the front and return it
+     *
+     * @return The highest scored unpicked move
+     */
+    Move pick_best();
+
+    /**
+     * @brief Check whether a move was already returned by an earlier stage
+     *
+     * @param move Move to check
+     * @return true for the hash move and (outside of check) the killers and countermove
+     */
+    bool already_tried(const Move& move) const;
+
+    /**
+     * @brief Check whether a killer or countermove can be played in this position
+     *
+     * These come from other nodes, so they are verified without generating moves.
+     *
+     * @param move Killer or countermove (already filtered to quiet moves)
+     * @return true if the move is legal here
+     */
+    bool is_legal_refutation(const Move& move) const;
+};
+
+#endif // MOVEPICKER_H
@@ -1,150 +1,194 @@
 #include "Search.h"
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 
-Search::Search() {
+Search::Search()
+    : owned_table(std::make_unique<TranspositionTable>()), transposition_table(owned_table.get()) {
     current_stats.reset();
+    init_reduction_table();
 }
 
-Move Search::find_best_move(Board& board, int depth) {
+Search::Search(TranspositionTable* shared_table, std::atomic<bool>* shared_stop)
+    : transposition_table(shared_table), stop_signal(shared_stop),
+      owned_evaluation(std::make_unique<Evaluation>()) {
     current_stats.reset();
-    
-    // Generate all legal moves for the current player
-    std::vector<Move> legal_moves = move_generator.generate_legal_moves(board);
-    
-    if (legal_moves.empty()) {
-        // No legal moves - return invalid move
-        return Move();
+    init_reduction_table();
+}
+
+Search::~Search() {
+    stop();
+    stop_helpers();
+}
+
+void Search::set_threads(int count) {
+    stop_helpers();
+    helpers.clear();
+    
+    // Every helper shares this search's table and stop flag but owns its
+    // board copy, move generator, move history and evaluation (with pawn hash)
+    for (int i = 1; i < std::max(1, count); ++i) {
+        helpers.push_back(std::unique_ptr<Search>(new Search(transposition_table, &stop_flag)));
+        helpers.back()->set_reduction_parameters(reduction_parameters);
     }
-    
-    Move best_move = legal_moves[0];
-    int best_score = ALPHA_INIT;
-    
-    // Iterative deepening from depth 1 to specified depth
-    for (int search_depth = 1; search_depth <= depth; ++search_depth) {
-        int alpha = ALPHA_INIT;
-        int beta = BETA_INIT;
-        Move current_best_move = legal_moves[0];
-        int current_best_score = ALPHA_INIT;
-        
-        // Order moves for better alpha-beta pruning
-        order_moves(legal_moves, board);
-        
-        for (const Move& move : legal_moves) {
-            // Make the move
-            auto undo_data = board.make_move(move);
-            
-            // Search with minimax - now the opponent is to move
-            int score = -minimax(board, search_depth - 1, -beta, -alpha, 
-                                std::chrono::steady_clock::now(), std::chrono::milliseconds(0));
-            
-            // Undo the move immediately
-            board.undo_move(undo_data);
-            
-            if (score > current_best_score) {
-                current_best_score = score;
-                current_best_move = move;
-            }
-            
-            alpha = std::max(alpha, score);
-            if (alpha >= beta) {
-                current_stats.beta_cutoffs++;
-                break; // Beta cutoff
+}
+
+void Search::set_reduction_parameters(const ReductionParameters& parameters) {
+    reduction_parameters = parameters;
+    init_reduction_table();
+    for (auto& helper : helpers) {
+        helper->set_reduction_parameters(parameters);
+    }
+}
+
+void Search::init_reduction_table() {
+    for (int depth = 0; depth < MAX_PLY; ++depth) {
+        for (int move_number = 0; move_number < MAX_PLY; ++move_number) {
+            if (depth == 0 || move_number == 0) {
+                reduction_table[depth][move_number] = 0;
+                continue;
             }
-        }
-        
-        // Update best move and score
-        best_move = current_best_move;
-        best_score = current_best_score;
-        
-        // Check for mate - no need to search deeper
-        if (is_mate_score(best_score)) {
-            break;
+            double reduction = reduction_parameters.base +
+                               std::log(depth) * std::log(move_number) / reduction_parameters.divisor;
+            reduction_table[depth][move_number] = std::max(0, static_cast<int>(reduction));
         }
     }
-    
-    return best_move;
+}
+
+Move Search::find_best_move(Board& board, int depth) {
+    time_manager.start();
+    return iterative_deepening(board, depth).best_move;
 }
 
 Move Search::find_best_move_timed(Board& board, std::chrono::milliseconds time_limit) {
-    current_stats.reset();
-    auto start_time = std::chrono::steady_clock::now();
-    
-    // Generate all legal moves for the current player
-    std::vector<Move> legal_moves = move_generator.generate_legal_moves(board);
-    
-    if (legal_moves.empty()) {
-        // No legal moves - return invalid move
-        return Move();
+    time_manager.start(time_limit);
+    return iterative_deepening(board, MAX_DEPTH).best_move;
+}
+
+Search::SearchResult Search::search_with_stats(Board& board, int depth) {
+    time_manager.start();
+    return iterative_deepening(board, depth);
+}
+
+Search::SearchResult Search::search_with_stats_timed(Board& board, int depth, std::chrono::milliseconds time_limit) {
+    time_manager.start(time_limit);
+    return iterative_deepening(board, depth);
+}
+
+Search::SearchResult Search::search_with_stats_timed(Board& board, int depth,
+                                                     const TimeManager::TimeControl& time_control) {
+    time_manager.start(time_control);
+    return iterative_deepening(board, depth);
+}
+
+void Search::start_search(const Board& board, const SearchLimits& limits, ResultCallback on_finish) {
+    stop();
+    
+    active_limits = limits;
+    stop_requested = false;
+    pondering = limits.ponder;
+    searching = true;
+    search_thread = std::thread(&Search::async_search, this, board, std::move(on_finish));
+}
+
+Search::SearchResult Search::stop() {
+    request_stop();
+    return wait();
+}
+
+void Search::request_stop() {
+    {
+        std::lock_guard<std::mutex> lock(async_mutex);
+        stop_requested = true;
+    }
+    stop_flag = true;
+    async_condition.notify_all();
+}
+
+Search::SearchResult Search::wait() {
+    if (search_thread.joinable()) {
+        search_thread.join();
     }
+    stop_requested = false;
+    pondering = false;
+    return async_result;
+}
+
+void Search::ponderhit() {
+    {
+        std::lock_guard<std::mutex> lock(async_mutex);
+        pondering = false;
+    }
+    async_condition.notify_all();
+}
+
+Search::SearchResult Search::search_with_limits(Board& board, const SearchLimits& limits) {
+    active_limits = limits;
     
-    Move best_move = legal_moves[0];
-    int best_score = ALPHA_INIT;
+    // A ponder search runs without a clock until the pondered move is played
+    awaiting_ponderhit = limits.ponder && pondering;
+    if (awaiting_ponderhit) {
+        time_manager.start();
+    } else {
+        start_clock(limits);
+    }
     
-    // Iterative deepening with time control
-    for (int search_depth = 1; search_depth <= MAX_DEPTH; ++search_depth) {
-        if (is_time_up(start_time, time_limit)) {
-            break;
-        }
-        
-        int alpha = ALPHA_INIT;
-        int beta = BETA_INIT;
-        Move current_best_move = legal_moves[0];
-        int current_best_score = ALPHA_INIT;
-        
-        // Order moves for better alpha-beta pruning
-        order_moves(legal_moves, board);
-        
-        bool depth_completed = true;
-        for (const Move& move : legal_moves) {
-            if (is_time_up(start_time, time_limit)) {
-                depth_completed = false;
-                break;
-            }
-            
-            // Make the move
-            auto undo_data = board.make_move(move);
-            
-            // Search with minimax - now the opponent is to move
-            int score = -minimax(board, search_depth - 1, -beta, -alpha, start_time, time_limit);
-            
-            // Undo the move immediately
-            board.undo_move(undo_data);
-            
-            if (score > current_best_score) {
-                current_best_score = score;
-                current_best_move = move;
-            }
-            
-            alpha = std::max(alpha, score);
-            if (alpha >= beta) {
-                current_stats.beta_cutoffs++;
-                break; // Beta cutoff
-            }
-        }
-        
-        // Only update if we completed the depth
-        if (depth_completed) {
-            best_move = current_best_move;
-            best_score = current_best_score;
-            
-            // Check for mate - no need to search deeper
-            if (is_mate_score(best_score)) {
-                break;
-            }
-        }
+    node_limit = limits.nodes;
+    SearchResult result = iterative_deepening(board, limits.depth > 0 ? limits.depth : MAX_PLY - 1);
+    node_limit = 0;
+    return result;
+}
+
+void Search::async_search(Board board, ResultCallback on_finish) {
+    SearchResult result = search_with_limits(board, active_limits);
+    
+    // An infinite or ponder search must not report its move before the GUI asks
+    {
+        std::unique_lock<std::mutex> lock(async_mutex);
+        async_condition.wait(lock, [this] {
+            return stop_requested || (!active_limits.infinite && !pondering);
+        });
     }
+    awaiting_ponderhit = false;
     
-    return best_move;
+    async_result = result;
+    if (on_finish) {
+        on_finish(result);
+    }
+    searching = false;
 }
 
-Search::SearchResult Search::search_with_stats(Board& board, int depth) {
+void Search::start_clock(const SearchLimits& limits) {
+    if (limits.infinite) {
+        time_manager.start();
+    } else if (limits.move_time.count() > 0) {
+        time_manager.start(limits.move_time);
+    } else if (limits.time_control.time_left.count() > 0) {
+        time_manager.start(limits.time_control);
+    } else {
+        time_manager.start();
+    }
+}
+
+void Search::check_ponderhit() {
+    if (awaiting_ponderhit && !pondering.load(std::memory_order_relaxed)) {
+        awaiting_ponderhit = false;
+        start_clock(active_limits);
+    }
+}
+
+// Private helper functions
+Search::SearchResult Search::iterative_deepening(Board& board, int max_depth) {
     SearchResult result;
     current_stats.reset();
-    auto start_time = std::chrono::steady_clock::now();
+    prepare_history();
+    transposition_table->new_search();
+    nodes_until_poll = TimeManager::NODES_BETWEEN_POLLS;
+    previous_pv_length = 0;
+    pv_length[0] = 0;
     
     // Generate all legal moves for the current player
-    std::vector<Move> legal_moves = move_generator.generate_legal_moves(board);
+    MoveList legal_moves = move_generator.generate_legal_moves(board);
     
     if (legal_moves.empty()) {
         // No legal moves - checkmate or stalemate
@@ -155,179 +199,209 @@ Search::SearchResult Search::search_with_stats(Board& board, int depth) {
         } else {
             result.score = 0; // Stalemate
         }
-        auto end_time = std::chrono::steady_clock::now();
-        result.stats.time_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+        result.stats.time_elapsed = time_manager.elapsed();
         return result;
     }
     
     Move best_move = legal_moves[0];
-    int best_score = ALPHA_INIT;
-    
-    // Iterative deepening from depth 1 to specified depth
-    for (int search_depth = 1; search_depth <= depth; ++search_depth) {
-        int alpha = ALPHA_INIT;
-        int beta = BETA_INIT;
-        Move current_best_move = legal_moves[0];
-        int current_best_score = ALPHA_INIT;
+    max_depth = std::min(max_depth, MAX_PLY - 1);
+    start_helpers(board, max_depth);
+    int best_score = 0;
+    std::chrono::milliseconds last_iteration(0);
+    
+    for (int search_depth = 1; search_depth <= max_depth; ++search_depth) {
+        // Do not start an iteration that is not expected to finish in time
+        check_ponderhit();
+        if (search_depth > 1 && !time_manager.can_start_iteration(last_iteration)) {
+            break;
+        }
         
-        // Order moves for better alpha-beta pruning
-        order_moves(legal_moves, board);
+        std::chrono::milliseconds iteration_start = time_manager.elapsed();
+        bool depth_completed = true;
+        int score = aspiration_search(board, search_depth, best_score, best_move, depth_completed);
         
-        for (const Move& move : legal_moves) {
-            // Make the move
-            auto undo_data = board.make_move(move);
-            
-            // Search with minimax - now the opponent is to move
-            int score = -minimax(board, search_depth - 1, -beta, -alpha, 
-                                std::chrono::steady_clock::now(), std::chrono::milliseconds(0));
-            
-            // Undo the move immediately
-            board.undo_move(undo_data);
-            
-            if (score > current_best_score) {
-                current_best_score = score;
-                current_best_move = move;
-            }
-            
-            alpha = std::max(alpha, score);
-            if (alpha >= beta) {
-                current_stats.beta_cutoffs++;
-                break; // Beta cutoff
-            }
+        // Only trust the score if we completed the depth
+        if (!depth_completed) {
+            break;
         }
-        
-        // Update best move and score
-        best_move = current_best_move;
-        best_score = current_best_score;
+        best_score = score;
         result.depth = search_depth;
+        last_iteration = time_manager.elapsed() - iteration_start;
+        save_pv();
+        result.is_mate = is_mate_score(best_score);
+        result.mate_in = result.is_mate ? mate_distance(best_score) : 0;
         
-        // Check for mate
-        if (is_mate_score(best_score)) {
-            result.is_mate = true;
-            result.mate_in = mate_distance(best_score);
-            break; // Found mate, no need to search deeper
+        if (progress_callback) {
+            SearchResult progress = result;
+            progress.best_move = best_move;
+            progress.score = best_score;
+            for (int i = 0; i < previous_pv_length; ++i) {
+                progress.pv.push_back(previous_pv[i]);
+            }
+            progress.stats = current_stats;
+            progress.stats.tt_hashfull = transposition_table->hashfull();
+            progress.stats.time_elapsed = time_manager.elapsed();
+            progress_callback(progress);
+        }
+        
+        // Mate found - no need to search deeper
+        if (result.is_mate) {
+            break;
         }
     }
     
     result.best_move = best_move;
     result.score = best_score;
-    result.stats = current_stats;
     
-    auto end_time = std::chrono::steady_clock::now();
-    result.stats.time_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    // An interrupted iteration may have replaced the best move; its line is
+    // then the one in progress at the root
+    const Move* line = previous_pv;
+    int line_length = previous_pv_length;
+    if (pv_length[0] > 0 && pv_table[0][0] == best_move && (line_length == 0 || line[0] != best_move)) {
+        line = pv_table[0];
+        line_length = pv_length[0];
+    }
+    for (int i = 0; i < line_length; ++i) {
+        result.pv.push_back(line[i]);
+    }
+    if (result.pv.empty()) {
+        result.pv.push_back(best_move);
+    }
+    
+    stop_helpers();
+    current_stats.tt_hashfull = transposition_table->hashfull();
+    result.stats = current_stats;
+    result.stats.time_elapsed = time_manager.elapsed();
     
     return result;
 }
 
-Search::SearchResult Search::search_with_stats_timed(Board& board, int depth, std::chrono::milliseconds time_limit) {
-    SearchResult result;
-    current_stats.reset();
-    auto start_time = std::chrono::steady_clock::now();
-    
-    // Generate all legal moves for the current player
-    std::vector<Move> legal_moves = move_generator.generate_legal_moves(board);
+int Search::aspiration_search(Board& board, int depth, int previous_score, Move& best_move, bool& completed) {
+    int alpha = ALPHA_INIT;
+    int beta = BETA_INIT;
+    int delta = ASPIRATION_WINDOW;
+    
+    // Shallow iterations are too unstable to predict, and mate scores jump
+    if (depth >= ASPIRATION_MIN_DEPTH && !is_mate_score(previous_score)) {
+        alpha = std::max(previous_score - delta, ALPHA_INIT);
+        beta = std::min(previous_score + delta, BETA_INIT);
+    }
     
-    if (legal_moves.empty()) {
-        // No legal moves - checkmate or stalemate
-        if (move_generator.is_in_check(board, board.get_active_color())) {
-            result.is_mate = true;
-            result.mate_in = 0;
-            result.score = -MATE_SCORE;
+    while (true) {
+        int score = search_root(board, depth, alpha, beta, best_move, completed);
+        if (!completed) {
+            return score;
+        }
+        
+        // Widen the side that failed and search again
+        if (score <= alpha && alpha > ALPHA_INIT) {
+            beta = (alpha + beta) / 2;
+            alpha = std::max(score - delta, ALPHA_INIT);
+        } else if (score >= beta && beta < BETA_INIT) {
+            beta = std::min(score + delta, BETA_INIT);
         } else {
-            result.score = 0; // Stalemate
+            return score;
         }
-        auto end_time = std::chrono::steady_clock::now();
-        result.stats.time_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-        return result;
+        
+        current_stats.aspiration_researches++;
+        delta *= 2;
     }
-    
-    Move best_move = legal_moves[0];
-    int best_score = ALPHA_INIT;
-    
-    // Iterative deepening with both depth and time limits
-    for (int search_depth = 1; search_depth <= depth; ++search_depth) {
-        if (is_time_up(start_time, time_limit)) {
+}
+
+int Search::search_root(Board& board, int depth, int alpha, int beta, Move& best_move, bool& completed) {
+    int original_alpha = alpha;
+    Move current_best_move = best_move;
+    int current_best_score = ALPHA_INIT;
+    int moves_searched = 0;
+    completed = true;
+    pv_length[0] = 0;
+    on_previous_pv[0] = true;
+    
+    // The best move of the previous iteration is searched first
+    MovePicker picker(board, move_generator, best_move);
+    Move move;
+    
+    while (!(move = picker.next_move()).is_null()) {
+        if (should_stop()) {
+            completed = false;
             break;
         }
         
-        int alpha = ALPHA_INIT;
-        int beta = BETA_INIT;
-        Move current_best_move = legal_moves[0];
-        int current_best_score = ALPHA_INIT;
-        
-        // Order moves for better alpha-beta pruning
-        order_moves(legal_moves, board);
+        // Make the move
+        auto undo_data = board.apply_move(move);
+        move_stack[0] = move;
         
-        bool depth_completed = true;
-        for (const Move& move : legal_moves) {
-            if (is_time_up(start_time, time_limit)) {
-                depth_completed = false;
-                break;
-            }
-            
-            // Make the move
-            auto undo_data = board.make_move(move);
-            
-            // Search with minimax - now the opponent is to move
-            int score = -minimax(board, search_depth - 1, -beta, -alpha, start_time, time_limit);
-            
-            // Undo the move immediately
-            board.undo_move(undo_data);
-            
-            if (score > current_best_score) {
-                current_best_score = score;
-                current_best_move = move;
-            }
-            
-            alpha = std::max(alpha, score);
-            if (alpha >= beta) {
-                current_stats.beta_cutoffs++;
-                break; // Beta cutoff
+        // Principal variation search: the first move gets the full window,
+        // the rest only have to prove they are no better than alpha
+        int score;
+        if (moves_searched == 0) {
+            score = -minimax(board, depth - 1, 1, -beta, -alpha);
+        } else {
+            score = -minimax(board, depth - 1, 1, -alpha - 1, -alpha);
+            if (score > alpha && score < beta) {
+                score = -minimax(board, depth - 1, 1, -beta, -alpha);
             }
         }
+        moves_searched++;
         
-        // Only update if we completed the depth
-        if (depth_completed) {
-            best_move = current_best_move;
-            best_score = current_best_score;
-            result.depth = search_depth;
-            
-            // Check for mate
-            if (is_mate_score(best_score)) {
-                result.is_mate = true;
-                result.mate_in = mate_distance(best_score);
-                break; // Found mate, no need to search deeper
-            }
+        // Undo the move immediately
+        board.undo_move(undo_data);
+        
+        // A move whose search was cut short has no usable score
+        if (should_stop()) {
+            completed = false;
+            break;
+        }
+        
+        if (score > alpha) {
+            update_pv(0, move);
+        }
+        
+        if (score > current_best_score) {
+            current_best_score = score;
+            current_best_move = move;
+        }
+        
+        alpha = std::max(alpha, score);
+        if (alpha >= beta) {
+            current_stats.beta_cutoffs++;
+            break; // Beta cutoff
         }
     }
     
-    result.best_move = best_move;
-    result.score = best_score;
-    result.stats = current_stats;
-    
-    auto end_time = std::chrono::steady_clock::now();
-    result.stats.time_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    // A fail-low keeps the previous best move, since every move is only
+    // known to be worse than alpha. A move that beat alpha is taken even
+    // from an interrupted iteration, as it was searched to the full depth.
+    if (current_best_score > original_alpha) {
+        best_move = current_best_move;
+        if (completed) {
+            TranspositionTable::Bound bound = current_best_score >= beta ? TranspositionTable::BOUND_LOWER
+                                                                         : TranspositionTable::BOUND_EXACT;
+            transposition_table->store(board.get_hash_key(), best_move, score_to_tt(current_best_score, 0),
+                                       depth, bound);
+        }
+    }
     
-    return result;
+    return current_best_score;
 }
 
-// Private helper functions
-int Search::minimax(Board& board, int depth, int alpha, int beta,
-                   std::chrono::steady_clock::time_point start_time,
-                   std::chrono::milliseconds time_limit) {
+int Search::minimax(Board& board, int depth, int ply, int alpha, int beta, bool allow_null) {
+    // Horizon reached - resolve captures before evaluating
+    if (depth <= 0) {
+        return quiescence(board, ply, alpha, beta);
+    }
+    
     current_stats.nodes_searched++;
+    check_time();
     
-    // Check time limit only if specified
-    if (time_limit.count() > 0 && is_time_up(start_time, time_limit)) {
-        return 0; // Return neutral score if time is up
+    if (ply >= MAX_PLY) {
+        return evaluate(board);
     }
+    pv_length[ply] = ply;
     
-    // Terminal node - evaluate position
-    if (depth == 0) {
-        if (evaluation) {
-            return evaluation->evaluate(board);
-        }
-        return 0; // No evaluation function available
+    // Stopped by the time limit or from outside: the score is discarded
+    if (should_stop()) {
+        return 0;
     }
     
     // Check for draw
@@ -335,37 +409,240 @@ int Search::minimax(Board& board, int depth, int alpha, int beta,
         return 0;
     }
     
-    // Generate legal moves for the current active player
-    std::vector<Move> legal_moves = move_generator.generate_legal_moves(board);
+    // A stored result for this position may settle a non-PV node outright;
+    // if not, its best move is still the first one to try
+    bool pv_node = beta - alpha > 1;
+    uint64_t key = board.get_hash_key();
+    TranspositionTable::ProbeResult tt_entry;
+    current_stats.tt_probes++;
+    if (transposition_table->probe(key, tt_entry)) {
+        current_stats.tt_hits++;
+        if (!pv_node && tt_entry.depth >= depth) {
+            int tt_score = score_from_tt(tt_entry.score, ply);
+            if (tt_entry.bound == TranspositionTable::BOUND_EXACT ||
+                (tt_entry.bound == TranspositionTable::BOUND_LOWER && tt_score >= beta) ||
+                (tt_entry.bound == TranspositionTable::BOUND_UPPER && tt_score <= alpha)) {
+                return tt_score;
+            }
+        }
+    }
     
-    if (legal_moves.empty()) {
+    // Null-move pruning: if passing still leaves the opponent unable to reach
+    // beta, a real move will almost certainly do at least as well
+    Board::Color side = board.get_active_color();
+    bool in_check = move_generator.is_in_check(board, side);
+    if (allow_null && !pv_node && !in_check && depth >= NULL_MOVE_MIN_DEPTH &&
+        beta > -MATE_SCORE + MAX_PLY && beta < MATE_SCORE - MAX_PLY &&
+        has_non_pawn_material(board, side) &&
+        evaluate(board) >= beta) {
+        int reduction = NULL_MOVE_BASE_REDUCTION + depth / NULL_MOVE_DEPTH_DIVISOR;
+        
+        auto null_undo = board.make_null_move();
+        move_stack[ply] = Move();
+        int null_score = -minimax(board, depth - 1 - reduction, ply + 1, -beta, -beta + 1, false);
+        board.undo_null_move(null_undo);
+        
+        if (should_stop()) {
+            return 0;
+        }
+        
+        if (null_score >= beta) {
+            // A mate found after passing is not a proven mate
+            if (null_score >= MATE_SCORE - MAX_PLY) {
+                null_score = beta;
+            }
+            
+            if (depth < NULL_MOVE_VERIFY_DEPTH) {
+                return null_score;
+            }
+            
+            // Deep cutoffs are verified by searching the real moves at the
+            // same reduced depth, without null moves
+            int verify_score = minimax(board, depth - reduction, ply, beta - 1, beta, false);
+            if (verify_score >= beta) {
+                return null_score;
+            }
+        }
+    }
+    
+    // Moves are generated stage by stage, so a cutoff skips the later stages
+    // Along the previous iteration's PV, its move comes before the hash move
+    Move previous_move = move_stack[ply - 1];
+    bool on_pv = on_previous_pv[ply - 1] && ply <= previous_pv_length && previous_move == previous_pv[ply - 1];
+    on_previous_pv[ply] = on_pv;
+    Move first_move = on_pv && ply < previous_pv_length ? previous_pv[ply] : tt_entry.move;
+    MovePicker picker(board, move_generator, first_move, move_history.killers(ply),
+                      move_history.countermove(previous_move), &move_history);
+    Move move;
+    
+    int original_alpha = alpha;
+    int best_score = ALPHA_INIT;
+    Move best_move;
+    int moves_searched = 0;
+    Move quiets_tried[MAX_QUIETS_TRACKED];
+    int quiet_count = 0;
+    const ReductionParameters& params = reduction_parameters;
+    int lmp_move_count = params.lmp_base + depth * depth;
+    
+    while (!(move = picker.next_move()).is_null()) {
+        if (should_stop()) {
+            return best_score;
+        }
+        
+        // Make the move
+        auto undo_data = board.apply_move(move);
+        // Checks, captures and promotions are never reduced or pruned
+        bool quiet = !move.is_capture() && !move.is_promotion() &&
+                     !board.is_in_check(board.get_active_color());
+        
+        // Late move pruning: at shallow non-PV nodes, quiet moves this far
+        // down the ordering almost never refute anything
+        if (quiet && !pv_node && !in_check && depth <= params.lmp_max_depth &&
+            moves_searched >= lmp_move_count && best_score > -MATE_SCORE + MAX_PLY) {
+            board.undo_move(undo_data);
+            continue;
+        }
+        moves_searched++;
+        move_stack[ply] = move;
+        
+        // Recursive call with negated alpha-beta window
+        // After making a move, it's the opponent's turn, so we negate the result.
+        // Only the first move is searched with the full window; later moves
+        // get a null window and are re-searched only if they beat alpha.
+        int score;
+        if (moves_searched == 1) {
+            score = -minimax(board, depth - 1, ply + 1, -beta, -alpha);
+        } else {
+            // Late quiet moves start at reduced depth
+            int reduction = 0;
+            if (quiet && !in_check && depth >= params.min_depth &&
+                moves_searched > params.full_depth_moves) {
+                reduction = get_reduction(depth, moves_searched) - (pv_node ? 1 : 0);
+                // Never below depth 1; min_depth may be set as low as 1
+                reduction = std::max(0, std::min(reduction, depth - 2));
+            }
+            
+            score = -minimax(board, depth - 1 - reduction, ply + 1, -alpha - 1, -alpha);
+            if (reduction > 0) {
+                current_stats.reduced_moves++;
+                if (score > alpha) {
+                    current_stats.reduced_researches++;
+                    score = -minimax(board, depth - 1, ply + 1, -alpha - 1, -alpha);
+                }
+            }
+            if (score > alpha && score < beta) {
+                score = -minimax(board, depth - 1, ply + 1, -beta, -alpha);
+            }
+        }
+        
+        // Undo the move immediately
+        board.undo_move(undo_data);
+        
+        if (score > best_score) {
+            best_score = score;
+            best_move = move;
+        }
+        if (pv_node && score > alpha) {
+            update_pv(ply, move);
+        }
+        alpha = std::max(alpha, score);
+        
+        if (alpha >= beta) {
+            current_stats.beta_cutoffs++;
+            if (!move.is_capture() && !move.is_promotion()) {
+                move_history.update_quiet_cutoff(side, move, previous_move, ply, depth, quiets_tried, quiet_count);
+            }
+            break; // Beta cutoff
+        }
+        
+        if (!move.is_capture() && !move.is_promotion() && quiet_count < MAX_QUIETS_TRACKED) {
+            quiets_tried[quiet_count++] = move;
+        }
+    }
+    
+    if (moves_searched == 0) {
         // No legal moves - checkmate or stalemate
         if (move_generator.is_in_check(board, board.get_active_color())) {
-            // Checkmate - return negative mate score (bad for current player)
-            return -MATE_SCORE + depth;
+            // Checkmate - return negative mate score (bad for current player),
+            // shorter mates score higher
+            return -MATE_SCORE + ply;
         }
         // Stalemate
         return 0;
     }
     
-    // Order moves for better pruning
-    order_moves(legal_moves, board);
+    // Scores from an interrupted subtree are unreliable and must not be stored
+    if (should_stop()) {
+        return best_score;
+    }
+    
+    TranspositionTable::Bound bound = best_score <= original_alpha ? TranspositionTable::BOUND_UPPER
+                                    : best_score >= beta ? TranspositionTable::BOUND_LOWER
+                                    : TranspositionTable::BOUND_EXACT;
+    transposition_table->store(key, bound == TranspositionTable::BOUND_UPPER ? Move() : best_move,
+                              score_to_tt(best_score, ply), depth, bound);
+    
+    return best_score;
+}
+
+int Search::quiescence(Board& board, int ply, int alpha, int beta) {
+    current_stats.nodes_searched++;
+    current_stats.qnodes_searched++;
+    check_time();
     
+    // The PV ends where quiescence begins
+    if (ply < MAX_PLY) {
+        pv_length[ply] = ply;
+    }
+    
+    if (should_stop()) {
+        return 0;
+    }
+    
+    if (ply >= MAX_PLY) {
+        return evaluate(board);
+    }
+    
+    bool in_check = board.is_in_check(board.get_active_color());
     int best_score = ALPHA_INIT;
+    int stand_pat = 0;
     
-    for (const Move& move : legal_moves) {
-        if (time_limit.count() > 0 && is_time_up(start_time, time_limit)) {
-            break;
+    if (!in_check) {
+        // Stand pat: the side to move is not forced to capture
+        stand_pat = evaluate(board);
+        if (stand_pat >= beta) {
+            return stand_pat;
         }
         
-        // Make the move
-        auto undo_data = board.make_move(move);
+        // Not even winning a queen would lift the score to alpha
+        if (stand_pat + PIECE_VALUES[Board::QUEEN] + DELTA_MARGIN < alpha) {
+            return stand_pat;
+        }
         
-        // Recursive call with negated alpha-beta window
-        // After making a move, it's the opponent's turn, so we negate the result
-        int score = -minimax(board, depth - 1, -beta, -alpha, start_time, time_limit);
+        alpha = std::max(alpha, stand_pat);
+        best_score = stand_pat;
+    }
+    
+    // Captures and promotions that do not lose material by SEE, or every
+    // evasion when in check
+    MovePicker picker(board, move_generator);
+    Move move;
+    int moves_searched = 0;
+    
+    while (!(move = picker.next_move()).is_null()) {
+        if (!in_check) {
+            // Delta pruning: the capture cannot bring the score back to alpha
+            int gain = move.is_capture() ? PIECE_VALUES[move.captured_type()] : 0;
+            if (move.is_promotion()) {
+                gain += PIECE_VALUES[move.promotion_type()] - PIECE_VALUES[Board::PAWN];
+            } else if (stand_pat + gain + DELTA_MARGIN <= alpha) {
+                continue;
+            }
+        }
         
-        // Undo the move immediately
+        auto undo_data = board.apply_move(move);
+        moves_searched++;
+        int score = -quiescence(board, ply + 1, -beta, -alpha);
         board.undo_move(undo_data);
         
         best_score = std::max(best_score, score);
@@ -373,26 +650,136 @@ int Search::minimax(Board& board, int depth, int alpha, int beta,
         
         if (alpha >= beta) {
             current_stats.beta_cutoffs++;
-            break; // Beta cutoff
+            break;
         }
     }
     
+    // In check with no evasion: checkmate
+    if (in_check && moves_searched == 0) {
+        return -MATE_SCORE + ply;
+    }
+    
     return best_score;
 }
 
-bool Search::is_time_up(std::chrono::steady_clock::time_point start_time,
-                       std::chrono::milliseconds time_limit) const {
-    if (time_limit.count() <= 0) {
-        return false; // No time limit
+void Search::start_helpers(const Board& board, int max_depth) {
+    // A stop() that arrived before the search got here must not be lost
+    stop_flag = false;
+    if (stop_requested) {
+        stop_flag = true;
     }
     
-    auto current_time = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(current_time - start_time);
-    return elapsed >= time_limit;
+    for (size_t i = 0; i < helpers.size(); ++i) {
+        Search* helper = helpers[i].get();
+        helper->evaluation = evaluation ? helper->owned_evaluation.get() : nullptr;
+        helper->persistent_history = persistent_history;
+        
+        // Odd helpers start one ply deeper so the threads spread over
+        // neighbouring depths instead of searching in lockstep
+        int start_depth = 1 + static_cast<int>(i % 2);
+        helper_threads.emplace_back(&Search::helper_search, helper, board, start_depth, max_depth);
+    }
+}
+
+void Search::stop_helpers() {
+    if (helper_threads.empty()) {
+        return;
+    }
+    
+    stop_flag.store(true, std::memory_order_relaxed);
+    for (std::thread& thread : helper_threads) {
+        thread.join();
+    }
+    helper_threads.clear();
+    
+    // Report the work of all threads from the main search
+    for (const auto& helper : helpers) {
+        current_stats.nodes_searched += helper->current_stats.nodes_searched;
+        current_stats.qnodes_searched += helper->current_stats.qnodes_searched;
+        current_stats.beta_cutoffs += helper->current_stats.beta_cutoffs;
+        current_stats.reduced_moves += helper->current_stats.reduced_moves;
+        current_stats.reduced_researches += helper->current_stats.reduced_researches;
+        current_stats.tt_probes += helper->current_stats.tt_probes;
+        current_stats.tt_hits += helper->current_stats.tt_hits;
+    }
+}
+
+void Search::helper_search(Board board, int start_depth, int max_depth) {
+    current_stats.reset();
+    prepare_history();
+    previous_pv_length = 0;
+    pv_length[0] = 0;
+    Move best_move;
+    int best_score = 0;
+    
+    // Plain iterative deepening; the results only matter through the shared table
+    for (int search_depth = start_depth; search_depth <= max_depth; ++search_depth) {
+        if (should_stop()) {
+            break;
+        }
+        bool completed = true;
+        best_score = aspiration_search(board, search_depth, best_score, best_move, completed);
+        if (completed) {
+            save_pv();
+        }
+    }
+}
+
+void Search::update_pv(int ply, const Move& move) {
+    pv_table[ply][ply] = move;
+    int child_length = ply + 1 < MAX_PLY ? pv_length[ply + 1] : ply + 1;
+    for (int i = ply + 1; i < child_length; ++i) {
+        pv_table[ply][i] = pv_table[ply + 1][i];
+    }
+    pv_length[ply] = std::max(child_length, ply + 1);
+}
+
+void Search::save_pv() {
+    previous_pv_length = pv_length[0];
+    for (int i = 0; i < previous_pv_length; ++i) {
+        previous_pv[i] = pv_table[0][i];
+    }
+}
+
+void Search::clear_history() {
+    move_history.clear();
+    for (auto& helper : helpers) {
+        helper->move_history.clear();
+    }
+}
+
+void Search::prepare_history() {
+    if (persistent_history) {
+        move_history.age();
+    } else {
+        move_history.clear();
+    }
+}
+
+int Search::evaluate(const Board& board) {
+    if (!evaluation) {
+        return 0; // No evaluation function available
+    }
+    
+    // Evaluation scores from white's point of view; negamax needs the mover's
+    int score = evaluation->evaluate(board);
+    return board.get_active_color() == Board::WHITE ? score : -score;
+}
+
+void Search::check_time() {
+    if (--nodes_until_poll > 0) {
+        return;
+    }
+    nodes_until_poll = TimeManager::NODES_BETWEEN_POLLS;
+    
+    check_ponderhit();
+    if (time_manager.hard_limit_reached() || (node_limit > 0 && current_stats.nodes_searched >= node_limit)) {
+        stop_signal->store(true, std::memory_order_relaxed);
+    }
 }
 
 bool Search::is_mate_score(int score) const {
-    return std::abs(score) >= MATE_SCORE - MAX_DEPTH;
+    return std::abs(score) >= MATE_SCORE - MAX_PLY;
 }
 
 int Search::mate_distance(int score) const {
@@ -403,6 +790,23 @@ int Search::mate_distance(int score) const {
     }
 }
 
+int Search::score_to_tt(int score, int ply) const {
+    if (score >= MATE_SCORE - MAX_PLY) return score + ply;
+    if (score <= -MATE_SCORE + MAX_PLY) return score - ply;
+    return score;
+}
+
+int Search::score_from_tt(int score, int ply) const {
+    if (score >= MATE_SCORE - MAX_PLY) return score - ply;
+    if (score <= -MATE_SCORE + MAX_PLY) return score + ply;
+    return score;
+}
+
+bool Search::has_non_pawn_material(const Board& board, Board::Color color) const {
+    return (board.get_piece_bitboard(Board::KNIGHT, color) | board.get_piece_bitboard(Board::BISHOP, color) |
+            board.get_piece_bitboard(Board::ROOK, color) | board.get_piece_bitboard(Board::QUEEN, color)) != 0;
+}
+
 bool Search::is_draw(const Board& board) const {
     // Check 50-move rule
     if (board.get_halfmove_clock() >= 100) {
@@ -436,55 +840,3 @@ bool Search::is_draw(const Board& board) const {
     
     return false;
 }
-
-void Search::order_moves(std::vector<Move>& moves, const Board& board) {
-    // Simple move ordering: captures first, then quiet moves
-    std::sort(moves.begin(), moves.end(), [this, &board](const Move& a, const Move& b) {
-        return get_move_score(a, board) > get_move_score(b, board);
-    });
-}
-
-int Search::get_move_score(const Move& move, const Board& board) const {
-    int score = 0;
-    
-    // Prioritize captures (MVV-LVA: Most Valuable Victim - Least Valuable Attacker)
-    if (move.captured_piece != '.') {
-        char captured_piece = move.captured_piece;
-        char moving_piece = move.piece;
-        
-        // Get piece values
-        int victim_value = 0;
-        int attacker_value = 0;
-        
-        switch (std::tolower(captured_piece)) {
-            case 'p': victim_value = 100; break;
-            case 'n': victim_value = 300; break;
-            case 'b': victim_value = 300; break;
-            case 'r': victim_value = 500; break;
-            case 'q': victim_value = 900; break;
-            case 'k': victim_value = 10000; break;
-        }
-        
-        switch (std::tolower(moving_piece)) {
-            case 'p': attacker_value = 100; break;
-            case 'n': attacker_value = 300; break;
-            case 'b': attacker_value = 300; break;
-            case 'r': attacker_value = 500; break;
-            case 'q': attacker_value = 900; break;
-            case 'k': attacker_value = 10000; break;
-        }
-        
-        score += victim_value - attacker_value / 10;
-    }
-    
-    // Prioritize promotions
-    if (move.promotion_piece != '.') {
-        score += 800;
-    }
-    
-    // Prioritize checks (if we can detect them easily)
-    // This would require making the move and checking, which is expensive
-    // So we skip this for now in the simple implementation
-    
-    return score;
-}
\ No newline at end of file
@@ -5,8 +5,19 @@
 #include "../board/Move.h"
 #include "../board/MoveGenerator.h"
 #include "Evaluation.h"
+#include "MoveHistory.h"
+#include "MovePicker.h"
+#include "TimeManager.h"
+#include "TranspositionTable.h"
+#include <algorithm>
 #include <vector>
 #include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 /**
  * @brief Chess search engine implementing minimax with alpha-beta pruning
@@ -14,6 +25,16 @@
  * This class provides a complete chess search implementation using the minimax
  * algorithm with alpha-beta pruning for move selection. It supports iterative
  * deepening, time-limited searches, and basic move ordering for improved performance.
+ * 
+ * With set_threads(n > 1) a search runs Lazy SMP: n - 1 helper searches iterate
+ * over the same position on their own threads, each with a private board,
+ * move ordering history and evaluation, and share only the lock-free
+ * transposition table.
+ * The result is always the one found by the calling (main) thread.
+ * 
+ * start_search() runs a search on a background thread instead: progress is
+ * reported through a callback after every iteration, and stop() or
+ * ponderhit() may be called at any time from another thread.
  */
 class Search {
 public:
@@ -22,7 +43,14 @@ public:
      */
     struct SearchStats {
         int nodes_searched = 0;          ///< Total number of nodes evaluated
+        int qnodes_searched = 0;         ///< Quiescence nodes (also counted in nodes_searched)
         int beta_cutoffs = 0;            ///< Number of beta cutoffs (pruning events)
+        int aspiration_researches = 0;   ///< Root re-searches after an aspiration window failed
+        int reduced_moves = 0;           ///< Late moves searched at reduced depth
+        int reduced_researches = 0;      ///< Reduced moves re-searched at full depth after beating alpha
+        int tt_probes = 0;               ///< Transposition table lookups
+        int tt_hits = 0;                 ///< Lookups that found the position
+        int tt_hashfull = 0;             ///< Transposition table occupancy in permill
         std::chrono::milliseconds time_elapsed{0};  ///< Total search time
         
         /**
@@ -30,9 +58,25 @@ public:
          */
         void reset() {
             nodes_searched = 0;
+            qnodes_searched = 0;
             beta_cutoffs = 0;
+            aspiration_researches = 0;
+            reduced_moves = 0;
+            reduced_researches = 0;
+            tt_probes = 0;
+            tt_hits = 0;
+            tt_hashfull = 0;
             time_elapsed = std::chrono::milliseconds(0);
         }
+        
+        /**
+         * @brief Fraction of transposition table lookups that hit
+         * 
+         * @return Hit rate between 0.0 and 1.0
+         */
+        double tt_hit_rate() const {
+            return tt_probes > 0 ? static_cast<double>(tt_hits) / tt_probes : 0.0;
+        }
     };
     
     /**
@@ -45,19 +89,118 @@ public:
         SearchStats stats;       ///< Search statistics
         bool is_mate = false;    ///< Whether the result is a forced mate
         int mate_in = 0;         ///< Number of moves until mate (if is_mate is true)
+        MoveList pv;             ///< Principal variation, starting with best_move
+    };
+    
+    /**
+     * @brief Limits of a search started with search_with_limits() or start_search()
+     * 
+     * move_time takes precedence over time_control; with neither set, no
+     * node limit and depth 0 the search only ends on stop().
+     */
+    struct SearchLimits {
+        int depth = 0;                             ///< Deepest iteration (0 = no depth limit)
+        std::chrono::milliseconds move_time{0};    ///< Fixed time for this move (0 = not used)
+        TimeManager::TimeControl time_control;     ///< Game clock, used when its time_left is positive
+        int nodes = 0;                             ///< Stop after about this many main-thread nodes (0 = no limit)
+        bool infinite = false;                     ///< Ignore the time limits and keep the result until stop()
+        bool ponder = false;                       ///< Search on the opponent's time; the clock starts at ponderhit()
+    };
+    
+    /**
+     * @brief Receives a search result (progress after an iteration, or the final result)
+     */
+    using ResultCallback = std::function<void(const SearchResult&)>;
+    
+    /**
+     * @brief Tunable parameters of late move reductions and late move pruning
+     * 
+     * A quiet move searched as move number m of a node at depth d is reduced
+     * by base + ln(d) * ln(m) / divisor plies (one less at PV nodes).
+     */
+    struct ReductionParameters {
+        double base = 0.75;         ///< Constant part of every reduction
+        double divisor = 2.25;      ///< Divisor of ln(depth) * ln(move number)
+        int min_depth = 3;          ///< Shallowest depth at which late moves are reduced
+        int full_depth_moves = 3;   ///< Moves searched at full depth before reductions start
+        int lmp_max_depth = 3;      ///< Deepest non-PV node at which late quiet moves are pruned
+        int lmp_base = 3;           ///< Moves kept before pruning at depth d: lmp_base + d * d
     };
     
 private:
     MoveGenerator move_generator;     ///< Move generation engine
     Evaluation* evaluation = nullptr; ///< Position evaluation function
     SearchStats current_stats;        ///< Current search statistics
+    std::unique_ptr<TranspositionTable> owned_table; ///< Table of a top-level search (null in helpers)
+    TranspositionTable* transposition_table;         ///< Table in use, shared with the helpers
+    
+    // Lazy SMP
+    std::atomic<bool> stop_flag{false};              ///< Raised to end the helper searches
+    std::atomic<bool>* stop_signal = &stop_flag;     ///< Flag polled while searching (the parent's in helpers)
+    std::unique_ptr<Evaluation> owned_evaluation;    ///< Private evaluation and pawn hash of a helper
+    std::vector<std::unique_ptr<Search>> helpers;    ///< Helper searches, one per extra thread
+    std::vector<std::thread> helper_threads;         ///< Threads running the helpers during a search
+    
+    // Time management
+    TimeManager time_manager;                                    ///< Limits of the running search (unlimited in helpers)
+    int nodes_until_poll = TimeManager::NODES_BETWEEN_POLLS;     ///< Nodes left before the clock is read again
+    
+    // Asynchronous search
+    std::thread search_thread;                   ///< Thread running start_search()
+    std::mutex async_mutex;                      ///< Guards the wake-up conditions of a finished search
+    std::condition_variable async_condition;     ///< Signalled by stop() and ponderhit()
+    std::atomic<bool> searching{false};          ///< Whether a started search has not finished yet
+    std::atomic<bool> stop_requested{false};     ///< Raised by stop(); survives the start of the search
+    std::atomic<bool> pondering{false};          ///< Cleared by ponderhit()
+    bool awaiting_ponderhit = false;             ///< Ponder search whose clock has not started yet (search thread only)
+    SearchLimits active_limits;                  ///< Limits of the running search_with_limits() or start_search()
+    int node_limit = 0;                          ///< Node budget of the running search (0 = none)
+    SearchResult async_result;                   ///< Result of the last asynchronous search
+    ResultCallback progress_callback;            ///< Called after every completed iteration (may be empty)
     
     // Search parameters
     static constexpr int MAX_DEPTH = 10;
+    static constexpr int MAX_PLY = 64;
     static constexpr int MATE_SCORE = 30000;
     static constexpr int ALPHA_INIT = -31000;
     static constexpr int BETA_INIT = 31000;
     
+    // Aspiration windows
+    static constexpr int ASPIRATION_WINDOW = 25;    ///< Initial half-width around the previous score
+    static constexpr int ASPIRATION_MIN_DEPTH = 4;  ///< First iteration that uses a narrowed window
+    
+    // Null-move pruning
+    static constexpr int NULL_MOVE_MIN_DEPTH = 3;     ///< Shallowest node that tries a null move
+    static constexpr int NULL_MOVE_BASE_REDUCTION = 3; ///< R at low depth; grows by one every NULL_MOVE_DEPTH_DIVISOR plies
+    static constexpr int NULL_MOVE_DEPTH_DIVISOR = 6;
+    static constexpr int NULL_MOVE_VERIFY_DEPTH = 8;  ///< From this depth a null-move cutoff is verified
+    
+    // Quiet moves remembered per node for history penalties on a cutoff
+    static constexpr int MAX_QUIETS_TRACKED = 32;
+    
+    // Quiescence pruning
+    static constexpr int DELTA_MARGIN = 200;  ///< Slack added to a capture's gain before delta pruning
+    static constexpr int PIECE_VALUES[6] = {
+        EvalConstants::PAWN_VALUE, EvalConstants::KNIGHT_VALUE, EvalConstants::BISHOP_VALUE,
+        EvalConstants::ROOK_VALUE, EvalConstants::QUEEN_VALUE, EvalConstants::KING_VALUE
+    };
+    
+    // Quiet move ordering: killers, butterfly history and countermoves
+    MoveHistory move_history;
+    Move move_stack[MAX_PLY];         ///< Move played at each ply of the current line (null for a null move)
+    bool persistent_history = false;  ///< Age instead of clearing move_history between searches
+    
+    // Triangular PV table: pv_table[ply][ply..pv_length[ply]) is the best line found from ply
+    Move pv_table[MAX_PLY][MAX_PLY];
+    int pv_length[MAX_PLY];
+    Move previous_pv[MAX_PLY];        ///< PV of the last completed iteration, searched first in the next
+    int previous_pv_length = 0;
+    bool on_previous_pv[MAX_PLY];     ///< Whether the line leading to each ply follows previous_pv
+    
+    // Late move reductions, indexed by [depth][move number]
+    ReductionParameters reduction_parameters;
+    int reduction_table[MAX_PLY][MAX_PLY];
+    
 public:
     /**
      * @brief Constructor - initializes search engine
@@ -65,9 +208,12 @@ public:
     Search();
     
     /**
-     * @brief Default destructor
+     * @brief Destructor - joins any running helper threads
      */
-    ~Search() = default;
+    ~Search();
+    
+    Search(const Search&) = delete;
+    Search& operator=(const Search&) = delete;
     
     // Main search functions - 4 well-documented functions with clear purposes
     
@@ -123,6 +269,103 @@ public:
      */
     SearchResult search_with_stats_timed(Board& board, int depth, std::chrono::milliseconds time_limit);
     
+    /**
+     * @brief Perform a depth limited search on the game clock
+     * 
+     * Time is allocated by the TimeManager from the remaining time, increment
+     * and moves to go: no iteration starts past the soft limit or when it is
+     * not expected to finish, and the search is aborted at the hard limit.
+     * 
+     * @param board The current board position to search from
+     * @param depth Maximum search depth in plies (half-moves)
+     * @param time_control Clock of the side to move
+     * @return Complete search results with move, score, statistics, and mate information
+     */
+    SearchResult search_with_stats_timed(Board& board, int depth, const TimeManager::TimeControl& time_control);
+    
+    /**
+     * @brief Perform a search under any combination of depth, time and node limits
+     * 
+     * The synchronous counterpart of start_search(): returns when a limit is
+     * reached. The infinite flag only disables the time limits, and ponder
+     * is honoured only for searches started with start_search().
+     * 
+     * @param board The current board position to search from
+     * @param limits Depth, time and node limits
+     * @return Complete search results with move, score, statistics, and mate information
+     */
+    SearchResult search_with_limits(Board& board, const SearchLimits& limits);
+    
+    // Asynchronous search
+    
+    /**
+     * @brief Start searching a position on a background thread
+     * 
+     * Returns immediately; a search still running is stopped first. The
+     * search ends on its own when its depth or time limit is reached, except
+     * that infinite and ponder searches hold their result until stop() or
+     * (for ponder searches) ponderhit(). No other search function may be
+     * called until it has finished.
+     * 
+     * @param board The position to search (copied)
+     * @param limits Depth, time and mode of the search
+     * @param on_finish Called on the search thread with the final result (may be empty);
+     *                  it must not call stop() or wait()
+     */
+    void start_search(const Board& board, const SearchLimits& limits, ResultCallback on_finish = nullptr);
+    
+    /**
+     * @brief Stop the asynchronous search and wait for its result
+     * 
+     * Every thread polls the stop flag at each node, so this returns almost
+     * at once. The best move is the one of the last completed iteration, or
+     * a move an interrupted iteration had already proved better.
+     * 
+     * @return Result of the search (the previous result if none is running)
+     */
+    SearchResult stop();
+    
+    /**
+     * @brief Ask the asynchronous search to stop without waiting for it
+     * 
+     * Safe to call from any thread while another one is blocked in wait();
+     * that thread then receives the result.
+     */
+    void request_stop();
+    
+    /**
+     * @brief Wait for the asynchronous search to end on its own
+     * 
+     * Must not be used on an infinite or ponder search without a later stop()
+     * or ponderhit() from another thread.
+     * 
+     * @return Result of the search
+     */
+    SearchResult wait();
+    
+    /**
+     * @brief The opponent played the pondered move: turn the ponder search into a timed one
+     * 
+     * The clock of the search limits starts now. If the search has already
+     * finished, its result is released at once.
+     */
+    void ponderhit();
+    
+    /**
+     * @brief Check whether an asynchronous search is still running
+     */
+    bool is_searching() const { return searching.load(); }
+    
+    /**
+     * @brief Set a function to call after every completed iteration
+     * 
+     * The callback runs on the searching thread, with the node count of the
+     * main thread only. Call between searches only.
+     * 
+     * @param callback Progress callback (empty to disable)
+     */
+    void set_progress_callback(ResultCallback callback) { progress_callback = std::move(callback); }
+    
     // Configuration
     /**
      * @brief Set the evaluation function to use
@@ -131,6 +374,98 @@ public:
      */
     void set_evaluation(Evaluation* eval) { evaluation = eval; }
     
+    /**
+     * @brief Resize the transposition table
+     * 
+     * Reallocates and clears the table; call between searches only.
+     * 
+     * @param size_mb New table size in megabytes
+     */
+    void set_hash_size(size_t size_mb) { transposition_table->resize(size_mb); }
+    
+    /**
+     * @brief Forget every stored position (e.g. before a new game)
+     */
+    void clear_hash() { transposition_table->clear(); }
+    
+    /**
+     * @brief Set the time kept in reserve for communication lag on the game clock
+     * 
+     * @param overhead Time subtracted from the remaining time before allocating
+     */
+    void set_move_overhead(std::chrono::milliseconds overhead) { time_manager.set_move_overhead(overhead); }
+    
+    /**
+     * @brief Get the time kept in reserve for communication lag
+     */
+    std::chrono::milliseconds get_move_overhead() const { return time_manager.get_move_overhead(); }
+    
+    /**
+     * @brief Set the number of search threads
+     * 
+     * Call between searches only. Helper evaluations are default constructed
+     * and used only when an evaluation function is set on this search.
+     * 
+     * @param count Total thread count including the calling thread (at least 1)
+     */
+    void set_threads(int count);
+    
+    /**
+     * @brief Get the number of search threads
+     * 
+     * @return Total thread count including the calling thread
+     */
+    int get_threads() const { return static_cast<int>(helpers.size()) + 1; }
+    
+    /**
+     * @brief Choose whether move ordering history carries over between searches
+     * 
+     * When enabled, each new search only ages the killer, history and
+     * countermove tables, so consecutive searches of the same game reuse
+     * what earlier ones learned. Otherwise every search starts empty.
+     * 
+     * @param keep true to keep the tables between searches
+     */
+    void set_persistent_history(bool keep) { persistent_history = keep; }
+    
+    /**
+     * @brief Check whether move ordering history carries over between searches
+     */
+    bool get_persistent_history() const { return persistent_history; }
+    
+    /**
+     * @brief Forget all move ordering history (e.g. before a new game)
+     */
+    void clear_history();
+    
+    /**
+     * @brief Set the late move reduction and pruning parameters
+     * 
+     * Rebuilds the reduction table of this search and its helpers; call
+     * between searches only.
+     * 
+     * @param parameters New parameters
+     */
+    void set_reduction_parameters(const ReductionParameters& parameters);
+    
+    /**
+     * @brief Get the late move reduction and pruning parameters
+     * 
+     * @return Current parameters
+     */
+    const ReductionParameters& get_reduction_parameters() const { return reduction_parameters; }
+    
+    /**
+     * @brief Look up the late move reduction for a quiet move
+     * 
+     * @param depth Remaining depth of the node
+     * @param move_number 1-based position of the move in the node's move order
+     * @return Reduction in plies from the table (before the PV adjustment)
+     */
+    int get_reduction(int depth, int move_number) const {
+        return reduction_table[std::min(depth, MAX_PLY - 1)][std::min(move_number, MAX_PLY - 1)];
+    }
+    
     /**
      * @brief Get current search statistics
      * 
@@ -144,31 +479,193 @@ public:
     void reset_stats() { current_stats.reset(); }
     
 private:
+    /**
+     * @brief Construct a Lazy SMP helper
+     * 
+     * @param shared_table Transposition table of the main search
+     * @param shared_stop Stop flag of the main search
+     */
+    Search(TranspositionTable* shared_table, std::atomic<bool>* shared_stop);
+    
+    /**
+     * @brief Launch the helper threads on a copy of the root position
+     * 
+     * Also clears the stop flag (unless stop() was already called), so it
+     * must be called at the start of every top-level search.
+     * 
+     * @param board The root position
+     * @param max_depth Deepest iteration the helpers may start
+     */
+    void start_helpers(const Board& board, int max_depth);
+    
+    /**
+     * @brief Stop and join the helper threads and add their statistics
+     */
+    void stop_helpers();
+    
+    /**
+     * @brief Body of a helper thread: iterative deepening until stopped
+     * 
+     * @param board Private copy of the root position
+     * @param start_depth First iteration depth
+     * @param max_depth Last iteration depth
+     */
+    void helper_search(Board board, int start_depth, int max_depth);
+    
+    /**
+     * @brief Iterative deepening under the limits already set on time_manager
+     * 
+     * Shared body of the public search functions. An iteration stopped by
+     * the time limit does not count towards the reported depth, but a root
+     * move it proved better is still returned.
+     * 
+     * @param board The root position
+     * @param max_depth Deepest iteration to search
+     * @return Complete search results
+     */
+    SearchResult iterative_deepening(Board& board, int max_depth);
+    
+    /**
+     * @brief Body of the thread started by start_search()
+     * 
+     * @param board Private copy of the root position
+     * @param on_finish Callback for the final result
+     */
+    void async_search(Board board, ResultCallback on_finish);
+    
+    /**
+     * @brief Start time_manager from the limits of an asynchronous search
+     * 
+     * @param limits Limits given to start_search()
+     */
+    void start_clock(const SearchLimits& limits);
+    
+    /**
+     * @brief Start the clock of a ponder search once ponderhit() was called
+     */
+    void check_ponderhit();
+    
+    /**
+     * @brief Run one iterative-deepening iteration with an aspiration window
+     * 
+     * The root is first searched with a narrow window centred on the previous
+     * iteration's score. On a fail-low or fail-high the failing side is
+     * widened (doubling each time) and the root searched again, until the
+     * score lands inside the window.
+     * 
+     * @param board The root position
+     * @param depth Search depth for this iteration
+     * @param previous_score Score of the previous iteration
+     * @param best_move In: move to search first. Out: best move found
+     * @param completed Set to false if the search was interrupted
+     * @return Score of the iteration
+     */
+    int aspiration_search(Board& board, int depth, int previous_score, Move& best_move, bool& completed);
+    
+    /**
+     * @brief Search every root move at a fixed depth with principal variation search
+     * 
+     * @param board The root position
+     * @param depth Search depth for this iteration
+     * @param alpha Lower bound of the root window
+     * @param beta Upper bound of the root window
+     * @param best_move In: move to search first (previous iteration's best).
+     *                  Out: best move found, updated unless every fully searched
+     *                  move failed low; an interrupted iteration still hands over
+     *                  a move that beat alpha before the stop
+     * @param completed Set to false if the search was stopped before every root move was searched
+     * @return Best score found at the root (fail-soft)
+     */
+    int search_root(Board& board, int depth, int alpha, int beta, Move& best_move, bool& completed);
+    
     /**
      * @brief Core minimax algorithm with alpha-beta pruning
      * 
+     * Moves come from a staged MovePicker, so a cutoff on an early move skips
+     * generating the rest. Principal variation search: after the first move,
+     * moves are searched with a null window and re-searched on a fail-high.
+     * 
+     * Null-move pruning: at non-PV nodes whose static evaluation already
+     * reaches beta, the side to move passes and the opponent gets a reduced
+     * search; if even that fails high the node is cut. The reduction grows
+     * with depth, the null move is skipped in check and when the mover has
+     * only pawns left (zugzwang), and deep cutoffs are confirmed by a
+     * reduced search of the real moves with null moves disabled.
+     * 
+     * Late quiet moves are searched at a depth reduced by get_reduction()
+     * and re-searched at full depth only if they beat alpha. At shallow
+     * non-PV nodes, quiet moves beyond a depth-dependent count are pruned.
+     * 
+     * PV nodes do not return early on a transposition table hit, so that
+     * the triangular PV table always holds a full line; along the previous
+     * iteration's PV, its move is searched first.
+     * 
      * @param board The current board position
      * @param depth Remaining search depth
+     * @param ply Distance from the root in half-moves
      * @param alpha Alpha value for pruning
      * @param beta Beta value for pruning
-     * @param start_time Search start time for time management
-     * @param time_limit Maximum search time allowed
+     * @param allow_null Whether this node may try a null move
      * @return Best evaluation score found
      */
-    int minimax(Board& board, int depth, int alpha, int beta, 
-                std::chrono::steady_clock::time_point start_time, 
-                std::chrono::milliseconds time_limit);
+    int minimax(Board& board, int depth, int ply, int alpha, int beta, bool allow_null = true);
+    
+    /**
+     * @brief Quiescence search over captures and promotions
+     * 
+     * Resolves tactical sequences at the horizon so that leaf scores are
+     * taken from quiet positions. The side to move may stand pat on the
+     * static evaluation; captures that cannot raise alpha even with a margin
+     * (delta pruning) or that lose material by static exchange evaluation
+     * are skipped. In check, every evasion is searched instead and mate is
+     * detected.
+     * 
+     * @param board The current board position
+     * @param ply Distance from the root in half-moves
+     * @param alpha Alpha value for pruning
+     * @param beta Beta value for pruning
+     * @return Best evaluation score found, from the side to move's perspective
+     */
+    int quiescence(Board& board, int ply, int alpha, int beta);
     
     // Helper functions
     /**
-     * @brief Check if search time limit has been exceeded
+     * @brief Static evaluation from the side to move's perspective
      * 
-     * @param start_time Search start time
-     * @param time_limit Maximum allowed time
-     * @return true if time limit exceeded
+     * @param board Board position to evaluate
+     * @return Evaluation score (0 if no evaluation function is set)
      */
-    bool is_time_up(std::chrono::steady_clock::time_point start_time, 
-                    std::chrono::milliseconds time_limit) const;
+    int evaluate(const Board& board);
+    
+    /**
+     * @brief Check whether a side has any piece besides pawns and the king
+     * 
+     * Positions without such material are where zugzwang is common, so
+     * null-move pruning is not trusted there.
+     * 
+     * @param board Current board position
+     * @param color Side to check
+     * @return true if the side has a knight, bishop, rook or queen
+     */
+    bool has_non_pawn_material(const Board& board, Board::Color color) const;
+    
+    /**
+     * @brief Check whether the search must be abandoned
+     * 
+     * Only reads the atomic stop flag; the clock is polled by check_time().
+     * 
+     * @return true if the stop flag is raised
+     */
+    bool should_stop() const { return stop_signal->load(std::memory_order_relaxed); }
+    
+    /**
+     * @brief Count a node and poll the clock every NODES_BETWEEN_POLLS nodes
+     * 
+     * Raises the stop flag (which also stops the helpers) once the hard
+     * time limit has passed or the node limit is used up. A pending
+     * ponderhit is picked up here too.
+     */
+    void check_time();
     
     /**
      * @brief Check if score represents a mate position
@@ -186,6 +683,27 @@ private:
      */
     int mate_distance(int score) const;
     
+    /**
+     * @brief Convert a score to the form stored in the transposition table
+     * 
+     * Mate scores are made relative to the node instead of the root, so the
+     * entry stays valid when the position is reached at another ply.
+     * 
+     * @param score Root-relative score
+     * @param ply Distance of the node from the root
+     * @return Node-relative score
+     */
+    int score_to_tt(int score, int ply) const;
+    
+    /**
+     * @brief Convert a stored transposition table score back to root-relative form
+     * 
+     * @param score Node-relative score from the table
+     * @param ply Distance of the node from the root
+     * @return Root-relative score
+     */
+    int score_from_tt(int score, int ply) const;
+    
     /**
      * @brief Check if position is a draw
      * 
@@ -196,21 +714,27 @@ private:
     
     // Move ordering for better alpha-beta pruning
     /**
-     * @brief Order moves for better search efficiency
-     * 
-     * @param moves Vector of moves to sort
-     * @param board Current board position
+     * @brief Clear or age the move ordering history at the start of a search
      */
-    void order_moves(std::vector<Move>& moves, const Board& board);
+    void prepare_history();
     
     /**
-     * @brief Calculate heuristic score for move ordering
+     * @brief Make a move that raised alpha the head of the PV at its ply
      * 
-     * @param move Move to evaluate
-     * @param board Current board position
-     * @return Heuristic score for move ordering
+     * @param ply Distance from the root in half-moves
+     * @param move The move; its child's line is appended from pv_table[ply + 1]
+     */
+    void update_pv(int ply, const Move& move);
+    
+    /**
+     * @brief Keep the root PV of a completed iteration for ordering the next one
+     */
+    void save_pv();
+    
+    /**
+     * @brief Fill reduction_table from reduction_parameters
      */
-    int get_move_score(const Move& move, const Board& board) const;
+    void init_reduction_table();
 };
 
 #endif // SEARCH_H
\ No newline at end of file
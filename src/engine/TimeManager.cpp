@@ -0,0 +1,37 @@
+#include "TimeManager.h"
+#include <algorithm>
+
+void TimeManager::start() {
+    start_time = std::chrono::steady_clock::now();
+    limited = false;
+    soft = hard = std::chrono::milliseconds(0);
+}
+
+void TimeManager::start(std::chrono::milliseconds move_time) {
+    start_time = std::chrono::steady_clock::now();
+    limited = true;
+    soft = hard = std::max(move_time, std::chrono::milliseconds(1));
+}
+
+void TimeManager::start(const TimeControl& time_control) {
+    start_time = std::chrono::steady_clock::now();
+    limited = true;
+
+    // Never plan to use the reserve, and never more than most of what is left
+    std::chrono::milliseconds available = std::max(time_control.time_left - move_overhead,
+                                                   std::chrono::milliseconds(1));
+    std::chrono::milliseconds ceiling = std::max(available * 8 / 10, std::chrono::milliseconds(1));
+    int moves_to_go = time_control.moves_to_go > 0 ? time_control.moves_to_go : DEFAULT_MOVES_TO_GO;
+
+    soft = std::min(available / moves_to_go + time_control.increment * 3 / 4, ceiling);
+    soft = std::max(soft, std::chrono::milliseconds(1));
+    hard = std::min(soft * HARD_LIMIT_FACTOR, ceiling);
+}
+
+bool TimeManager::can_start_iteration(std::chrono::milliseconds last_iteration) const {
+    if (!limited) {
+        return true;
+    }
+    std::chrono::milliseconds now = elapsed();
+    return now < soft && now + last_iteration * ITERATION_GROWTH <= hard;
+}
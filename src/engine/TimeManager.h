@@ -0,0 +1,125 @@
+#ifndef TIMEMANAGER_H
+#define TIMEMANAGER_H
+
+#include <chrono>
+
+/**
+ * @brief Decides how long a search may run
+ *
+ * A search is started either without a limit, with a fixed time per move, or
+ * from the game clock (remaining time, increment and moves to go). From the
+ * clock two limits are derived:
+ *
+ *   - the soft limit: the time the search should normally use; no new
+ *     iteration of iterative deepening starts past it
+ *   - the hard limit: the search is aborted once it is reached, even in the
+ *     middle of an iteration
+ *
+ * A configurable move overhead is kept in reserve for communication lag.
+ * Reading the clock is not free, so the search asks hard_limit_reached()
+ * only once every NODES_BETWEEN_POLLS nodes.
+ */
+class TimeManager {
+public:
+    /**
+     * @brief Clock situation of the side to move
+     */
+    struct TimeControl {
+        std::chrono::milliseconds time_left{0};   ///< Time remaining on the clock
+        std::chrono::milliseconds increment{0};   ///< Time added after each move
+        int moves_to_go = 0;                      ///< Moves until the next time control (0 = rest of the game)
+    };
+
+    static constexpr int NODES_BETWEEN_POLLS = 1024;  ///< Nodes searched between two clock reads
+    static constexpr int DEFAULT_MOVES_TO_GO = 30;    ///< Moves the remaining time is spread over when unknown
+    static constexpr int HARD_LIMIT_FACTOR = 4;       ///< Hard limit as a multiple of the soft limit
+    static constexpr int ITERATION_GROWTH = 2;        ///< Assumed time ratio of consecutive iterations
+    static constexpr std::chrono::milliseconds DEFAULT_MOVE_OVERHEAD{30};
+
+    TimeManager() { start(); }
+
+    /**
+     * @brief Start a search without a time limit
+     */
+    void start();
+
+    /**
+     * @brief Start a search with a fixed time for this move
+     *
+     * @param move_time Time the search may use; soft and hard limits are both set to it
+     */
+    void start(std::chrono::milliseconds move_time);
+
+    /**
+     * @brief Start a search from the game clock
+     *
+     * The time left (minus the move overhead) is spread over the moves to go,
+     * and most of the increment is added on top.
+     *
+     * @param time_control Clock of the side to move
+     */
+    void start(const TimeControl& time_control);
+
+    /**
+     * @brief Set the time kept in reserve for communication lag
+     *
+     * @param overhead Time subtracted from the clock before allocating
+     */
+    void set_move_overhead(std::chrono::milliseconds overhead) { move_overhead = overhead; }
+
+    /**
+     * @brief Get the time kept in reserve for communication lag
+     */
+    std::chrono::milliseconds get_move_overhead() const { return move_overhead; }
+
+    /**
+     * @brief Check whether the current search has a time limit
+     */
+    bool is_limited() const { return limited; }
+
+    /**
+     * @brief Time since the search was started
+     */
+    std::chrono::milliseconds elapsed() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time);
+    }
+
+    /**
+     * @brief Time the search should normally use
+     */
+    std::chrono::milliseconds soft_limit() const { return soft; }
+
+    /**
+     * @brief Time after which the search is aborted
+     */
+    std::chrono::milliseconds hard_limit() const { return hard; }
+
+    /**
+     * @brief Check whether the search must stop now
+     *
+     * Reads the clock; call it only every NODES_BETWEEN_POLLS nodes.
+     *
+     * @return true if the search is limited and the hard limit has passed
+     */
+    bool hard_limit_reached() const { return limited && elapsed() >= hard; }
+
+    /**
+     * @brief Decide whether another iteration of iterative deepening is worthwhile
+     *
+     * An iteration is started only before the soft limit and when, judging
+     * by the previous one, it can finish before the hard limit.
+     *
+     * @param last_iteration Time taken by the previous iteration
+     * @return true if the next iteration should be searched
+     */
+    bool can_start_iteration(std::chrono::milliseconds last_iteration) const;
+
+private:
+    std::chrono::steady_clock::time_point start_time;
+    std::chrono::milliseconds soft{0};
+    std::chrono::milliseconds hard{0};
+    std::chrono::milliseconds move_overhead = DEFAULT_MOVE_OVERHEAD;
+    bool limited = false;
+};
+
+#endif // TIMEMANAGER_H
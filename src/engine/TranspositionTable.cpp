@@ -0,0 +1,123 @@
+#include "TranspositionTable.h"
+#include <algorithm>
+
+TranspositionTable::TranspositionTable(size_t size_mb) {
+    resize(size_mb);
+}
+
+void TranspositionTable::resize(size_t size_mb) {
+    // Largest power-of-two bucket count that fits in the requested size
+    size_t requested_buckets = std::max<size_t>(1, size_mb * 1024 * 1024 / sizeof(Bucket));
+    size_t new_count = 1;
+    while (new_count * 2 <= requested_buckets) {
+        new_count *= 2;
+    }
+
+    // Release the old table first so peak memory stays at one table
+    buckets.reset();
+    buckets = std::make_unique<Bucket[]>(new_count);
+    bucket_count = new_count;
+    bucket_mask = new_count - 1;
+    generation = 0;
+}
+
+void TranspositionTable::clear() {
+    for (size_t i = 0; i < bucket_count; ++i) {
+        for (Entry& entry : buckets[i].entries) {
+            entry.key_xor_data.store(0, std::memory_order_relaxed);
+            entry.data.store(0, std::memory_order_relaxed);
+        }
+    }
+    generation = 0;
+}
+
+bool TranspositionTable::probe(uint64_t key, ProbeResult& result) const {
+    const Bucket& bucket = buckets[key & bucket_mask];
+
+    for (const Entry& entry : bucket.entries) {
+        uint64_t data = entry.data.load(std::memory_order_relaxed);
+        uint64_t key_xor_data = entry.key_xor_data.load(std::memory_order_relaxed);
+        if (data != 0 && (key_xor_data ^ data) == key) {
+            result.move = Move::from_raw(static_cast<uint32_t>(data));
+            result.score = static_cast<int16_t>(data >> 32);
+            result.depth = entry_depth(data);
+            result.bound = static_cast<Bound>((data >> 56) & 0x3);
+            return true;
+        }
+    }
+    return false;
+}
+
+void TranspositionTable::store(uint64_t key, Move move, int score, int depth, Bound bound) {
+    Bucket& bucket = buckets[key & bucket_mask];
+    Entry* replace = &bucket.entries[0];
+    int replace_worth = 0x7FFFFFFF;
+
+    for (Entry& entry : bucket.entries) {
+        uint64_t data = entry.data.load(std::memory_order_relaxed);
+        uint64_t key_xor_data = entry.key_xor_data.load(std::memory_order_relaxed);
+
+        // Same position: overwrite in place, keeping a known best move, unless
+        // a much shallower bound of this search would replace deeper knowledge
+        if (data != 0 && (key_xor_data ^ data) == key) {
+            Move old_move = Move::from_raw(static_cast<uint32_t>(data));
+            if (move.is_null()) {
+                move = old_move;
+            }
+            if (bound != BOUND_EXACT && depth + REPLACE_DEPTH_MARGIN < entry_depth(data) &&
+                entry_generation(data) == generation) {
+                // Keep score, depth and bound; only refresh the move and age
+                uint64_t refreshed = pack(move, static_cast<int16_t>(data >> 32), entry_depth(data),
+                                          static_cast<Bound>((data >> 56) & 0x3), generation);
+                entry.data.store(refreshed, std::memory_order_relaxed);
+                entry.key_xor_data.store(key ^ refreshed, std::memory_order_relaxed);
+                return;
+            }
+            replace = &entry;
+            break;
+        }
+
+        // Empty slot: nothing to lose
+        if (data == 0) {
+            replace = &entry;
+            break;
+        }
+
+        // Otherwise evict the shallowest entry, treating every search of age
+        // as eight plies of depth lost
+        int age = (generation - entry_generation(data)) & GENERATION_MASK;
+        int worth = entry_depth(data) - 8 * age;
+        if (worth < replace_worth) {
+            replace_worth = worth;
+            replace = &entry;
+        }
+    }
+
+    uint64_t data = pack(move, score, depth, bound, generation);
+    replace->data.store(data, std::memory_order_relaxed);
+    replace->key_xor_data.store(key ^ data, std::memory_order_relaxed);
+}
+
+int TranspositionTable::hashfull() const {
+    size_t sample_buckets = std::min<size_t>(bucket_count, 250);
+    int used = 0;
+
+    for (size_t i = 0; i < sample_buckets; ++i) {
+        for (const Entry& entry : buckets[i].entries) {
+            uint64_t data = entry.data.load(std::memory_order_relaxed);
+            if (data != 0 && entry_generation(data) == generation) {
+                used++;
+            }
+        }
+    }
+
+    return static_cast<int>(used * 1000 / (sample_buckets * ENTRIES_PER_BUCKET));
+}
+
+uint64_t TranspositionTable::pack(Move move, int score, int depth, Bound bound, uint8_t generation) {
+    return static_cast<uint64_t>(move.raw()) |
+           (static_cast<uint64_t>(static_cast<uint16_t>(score)) << 32) |
+           (static_cast<uint64_t>(std::clamp(depth, 0, 255)) << 48) |
+           (static_cast<uint64_t>(bound & 0x3) << 56) |
+           (static_cast<uint64_t>(generation & GENERATION_MASK) << 58);
+}
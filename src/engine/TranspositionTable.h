@@ -0,0 +1,161 @@
+#ifndef TRANSPOSITIONTABLE_H
+#define TRANSPOSITIONTABLE_H
+
+#include "../board/Move.h"
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+
+/**
+ * @brief Fixed-size, clustered transposition table
+ *
+ * The table is an array of cache-line sized buckets, each holding four
+ * 16-byte entries, so a probe touches exactly one cache line. The number of
+ * buckets is a power of two and the low bits of the Zobrist key select the
+ * bucket. Each entry keeps the full key (XORed with its data word, so a
+ * half-written entry never verifies), the best move, score, depth, bound
+ * type and the generation of the search that stored it.
+ *
+ * Replacement inside a bucket prefers an empty slot or the slot holding the
+ * same position, and otherwise evicts the entry with the lowest depth after
+ * penalising entries left over from earlier searches.
+ *
+ * probe() and store() may be called concurrently from several search threads
+ * without locking: both words of an entry are relaxed atomics, and an entry
+ * whose words come from two different writes fails the key check and reads
+ * as a miss. resize(), clear() and new_search() must not overlap a search.
+ */
+class TranspositionTable {
+public:
+    /**
+     * @brief Type of bound a stored score represents
+     */
+    enum Bound : uint8_t {
+        BOUND_NONE = 0,   ///< Empty entry
+        BOUND_UPPER = 1,  ///< Fail-low: the true score is at most the stored score
+        BOUND_LOWER = 2,  ///< Fail-high: the true score is at least the stored score
+        BOUND_EXACT = 3   ///< Exact score inside the search window
+    };
+
+    /**
+     * @brief Unpacked contents of a table entry returned by probe()
+     */
+    struct ProbeResult {
+        Move move;                 ///< Best move found for the position (may be null)
+        int score = 0;             ///< Stored score (mate scores are ply-relative to the node)
+        int depth = 0;             ///< Remaining depth the score was searched to
+        Bound bound = BOUND_NONE;  ///< What the score represents
+    };
+
+    static constexpr size_t DEFAULT_SIZE_MB = 16;
+    static constexpr int ENTRIES_PER_BUCKET = 4;
+    static constexpr int REPLACE_DEPTH_MARGIN = 2;   ///< Plies a non-exact store of the same position may lack
+
+    /**
+     * @brief Construct a table of the given size
+     *
+     * @param size_mb Table size in megabytes (rounded down to a power-of-two bucket count)
+     */
+    explicit TranspositionTable(size_t size_mb = DEFAULT_SIZE_MB);
+
+    /**
+     * @brief Reallocate the table with a new size and clear it
+     *
+     * @param size_mb Table size in megabytes (at least one bucket is kept)
+     */
+    void resize(size_t size_mb);
+
+    /**
+     * @brief Erase every entry
+     */
+    void clear();
+
+    /**
+     * @brief Start a new search generation
+     *
+     * Entries from earlier generations become preferred replacement victims.
+     */
+    void new_search() { generation = (generation + 1) & GENERATION_MASK; }
+
+    /**
+     * @brief Look up a position
+     *
+     * @param key Zobrist key of the position
+     * @param result Filled with the entry contents on a hit
+     * @return true if the position was found
+     */
+    bool probe(uint64_t key, ProbeResult& result) const;
+
+    /**
+     * @brief Store a search result
+     *
+     * If the position is already stored and the new move is null, the old
+     * best move is kept for move ordering. An entry of the current search is
+     * only overwritten by an exact score or by a search at most
+     * REPLACE_DEPTH_MARGIN plies shallower; otherwise just its move and
+     * generation are refreshed.
+     *
+     * @param key Zobrist key of the position
+     * @param move Best move found (null if none)
+     * @param score Score to store (already converted to a node-relative mate score)
+     * @param depth Remaining depth of the search
+     * @param bound Bound type of the score
+     */
+    void store(uint64_t key, Move move, int score, int depth, Bound bound);
+
+    /**
+     * @brief Estimate how full the table is
+     *
+     * Samples the first buckets and counts entries written by the current search.
+     *
+     * @return Occupancy in permill (0-1000)
+     */
+    int hashfull() const;
+
+    /**
+     * @brief Get the table size in megabytes
+     */
+    size_t size_mb() const { return bucket_count * sizeof(Bucket) / (1024 * 1024); }
+
+    /**
+     * @brief Get the number of entries the table can hold
+     */
+    size_t entry_count() const { return bucket_count * ENTRIES_PER_BUCKET; }
+
+private:
+    /**
+     * @brief One 16-byte table slot
+     *
+     * data packs move (bits 0-31), score (32-47), depth (48-55),
+     * bound (56-57) and generation (58-63).
+     */
+    struct Entry {
+        std::atomic<uint64_t> key_xor_data{0};
+        std::atomic<uint64_t> data{0};
+    };
+
+    /**
+     * @brief Four entries sharing one 64-byte cache line
+     */
+    struct alignas(64) Bucket {
+        Entry entries[ENTRIES_PER_BUCKET];
+    };
+
+    static_assert(sizeof(Entry) == 16, "Entry must stay 16 bytes");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "Entries must be lock-free");
+    static_assert(sizeof(Bucket) == 64, "Bucket must fill one cache line");
+
+    static constexpr uint8_t GENERATION_MASK = 0x3F;
+
+    std::unique_ptr<Bucket[]> buckets;
+    size_t bucket_count = 0;
+    uint64_t bucket_mask = 0;
+    uint8_t generation = 0;
+
+    static uint64_t pack(Move move, int score, int depth, Bound bound, uint8_t generation);
+    static uint8_t entry_generation(uint64_t data) { return static_cast<uint8_t>(data >> 58); }
+    static int entry_depth(uint64_t data) { return static_cast<int>((data >> 48) & 0xFF); }
+};
+
+#endif // TRANSPOSITIONTABLE_H
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "../batch/BatchAnalyzer.h"
+#include "../daemon/Daemon.h"
+#include "../uci/Uci.h"
+
+/**
+ * @brief Analyse a batch file (or stdin) and print one line per position as it finishes
+ *
+ * @return Process exit code
+ */
+static int run_batch(const std::string& path, const BatchAnalyzer::Options& options) {
+    std::ifstream file;
+    if (!path.empty()) {
+        file.open(path);
+        if (!file) {
+            std::cerr << "Cannot open " << path << "\n";
+            return 1;
+        }
+    }
+    std::istream& input = file.is_open() ? file : std::cin;
+
+    size_t positions = 0;
+    uint64_t nodes = 0;
+    auto start = std::chrono::steady_clock::now();
+    BatchAnalyzer analyzer(options, [&](const BatchAnalyzer::Analysis& analysis) {
+        std::cout << BatchAnalyzer::format(analysis) << std::endl;
+        positions++;
+        nodes += analysis.result.stats.nodes_searched;
+    });
+    analyzer.run(input);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    long long ms = std::max<long long>(1, elapsed.count());
+    std::cerr << positions << " positions, " << nodes << " nodes in " << elapsed.count() << "ms ("
+              << analyzer.worker_count() << " workers, " << nodes * 1000 / ms << " nps, "
+              << positions * 1000.0 / ms << " positions/s)\n";
+    return 0;
+}
+
+/**
+ * @brief Print the command line help
+ */
+static void print_usage(std::ostream& out) {
+    out << "Usage: yoki-engine [--daemon [--workers N] [--hash MB] [--threads N]]\n"
+        << "       yoki-engine --batch [FILE] [--workers N] [--hash MB] [--depth D] [--movetime MS] [--nodes N]\n"
+        << "Without options, speaks the UCI protocol on stdin/stdout, e.g.\n"
+        << "  position startpos moves e2e4\n"
+        << "  go depth 8 | go movetime 1000 | go wtime 60000 btime 60000 winc 1000 binc 1000\n"
+        << "  stop | quit\n"
+        << "With --daemon, reads one JSON request per line and answers each with one JSON line:\n"
+        << "  {\"id\": 1, \"fen\": \"<fen>\", \"moves\": [\"e2e4\"], \"depth\": 10, \"movetime\": 500}\n"
+        << "  {\"cmd\": \"cancel\", \"id\": 1} | {\"cmd\": \"ping\"} | {\"cmd\": \"quit\"}\n"
+        << "  --workers N   concurrent searches (default: one per hardware thread)\n"
+        << "  --hash MB     transposition table size of each worker\n"
+        << "  --threads N   search threads of each worker\n"
+        << "With --batch, searches every line of FILE (or stdin) on a pool of workers and prints\n"
+        << "one line per position as it finishes, tagged with its input index:\n"
+        << "  <fen> [; depth 12 movetime 500 nodes 100000]\n"
+        << "  --depth/--movetime/--nodes   limits of lines that set none (default: depth "
+        << BatchAnalyzer::DEFAULT_DEPTH << ")\n";
+}
+
+/**
+ * @brief Parse a numeric option value
+ *
+ * @param text Value as given on the command line
+ * @param value Receives the number
+ * @return false unless text is a whole number of at least 1
+ */
+static bool parse_positive(const std::string& text, int& value) {
+    try {
+        size_t used = 0;
+        value = std::stoi(text, &used);
+        return used == text.size() && value >= 1;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    bool daemon_mode = false;
+    bool batch_mode = false;
+    std::string batch_input;
+    Daemon::Options options;
+    BatchAnalyzer::Options batch_options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        bool has_value = i + 1 < argc;
+        if (argument == "--help" || argument == "-h") {
+            print_usage(std::cout);
+            return 0;
+        } else if (argument == "--daemon") {
+            daemon_mode = true;
+        } else if (argument == "--batch") {
+            batch_mode = true;
+            if (has_value && argv[i + 1][0] != '-') {
+                batch_input = argv[++i];
+            }
+        } else if (argument == "--workers" || argument == "--hash" || argument == "--threads") {
+            int value = 0;
+            if (!has_value || !parse_positive(argv[++i], value)) {
+                std::cerr << argument << " needs a whole number of at least 1\n\n";
+                print_usage(std::cerr);
+                return 1;
+            }
+            if (argument == "--workers") {
+                options.workers = batch_options.workers = value;
+            } else if (argument == "--hash") {
+                options.hash_mb = batch_options.hash_mb = static_cast<size_t>(value);
+            } else {
+                options.threads_per_search = value;
+            }
+        } else if (argument == "--depth" || argument == "--movetime" || argument == "--nodes") {
+            int value = 0;
+            if (!has_value || !parse_positive(argv[++i], value)) {
+                std::cerr << argument << " needs a whole number of at least 1\n\n";
+                print_usage(std::cerr);
+                return 1;
+            }
+            if (argument == "--depth") {
+                batch_options.default_limits.depth = value;
+            } else if (argument == "--movetime") {
+                batch_options.default_limits.move_time = std::chrono::milliseconds(value);
+            } else {
+                batch_options.default_limits.nodes = value;
+            }
+        } else {
+            std::cerr << "Unknown argument " << argument << " (see --help)\n";
+            return 1;
+        }
+    }
+
+    if (batch_mode) {
+        return run_batch(batch_input, batch_options);
+    }
+
+    if (daemon_mode) {
+        Daemon daemon(std::cout, options);
+        daemon.run();
+        return 0;
+    }
+
+    Uci uci;
+    uci.loop();
+    return 0;
+}
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <string>
+#include "../board/Board.h"
+#include "../board/Perft.h"
+
+namespace {
+
+void print_usage(std::ostream& out) {
+    out << "Usage: perft [--fen FEN] [--depth N] [--divide] [--threads N] [--hash MB] [--no-bulk]\n"
+        << "       perft --suite [--depth N] [--threads N] [--hash MB] [--no-bulk]\n"
+        << "Counts the leaf nodes of the legal move tree of a position (default: the start position).\n"
+        << "  --divide      also print the count below every root move\n"
+        << "  --threads N   split the root moves across N threads\n"
+        << "  --hash MB     reuse counts of transposed positions from a table of this size\n"
+        << "  --no-bulk     play the moves of the last ply instead of counting them\n"
+        << "  --suite       check the reference positions (startpos, Kiwipete, positions 3-6)\n"
+        << "                up to --depth (default: 5, capped at 6)\n";
+}
+
+/**
+ * @brief Parse a numeric option value
+ *
+ * @param text Value as given on the command line
+ * @param value Receives the number
+ * @return false unless text is a whole number of at least 1
+ */
+bool parse_positive(const std::string& text, int& value) {
+    try {
+        size_t used = 0;
+        value = std::stoi(text, &used);
+        return used == text.size() && value >= 1;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+void print_result(const Perft::Result& result) {
+    std::cout << "Nodes: " << result.nodes << "  time: " << result.time.count() / 1000 << "ms  nps: "
+              << result.nodes_per_second() << "\n";
+}
+
+/**
+ * @brief Count every reference position at every depth up to max_depth
+ *
+ * @return true if every count matches its reference
+ */
+bool run_suite(Perft& perft, int max_depth) {
+    bool all_passed = true;
+    uint64_t total_nodes = 0;
+    int64_t total_time = 0;
+
+    for (const Perft::ReferencePosition& position : Perft::REFERENCE_POSITIONS) {
+        Board board;
+        board.set_from_fen(position.fen);
+        for (int depth = 1; depth <= max_depth; ++depth) {
+            Perft::Result result = perft.divide(board, depth);
+            uint64_t expected = position.nodes[depth - 1];
+            bool passed = result.nodes == expected;
+            all_passed &= passed;
+            total_nodes += result.nodes;
+            total_time += result.time.count();
+            std::cout << (passed ? "✓ " : "✗ ") << position.name << " perft(" << depth << ") = " << result.nodes;
+            if (!passed) {
+                std::cout << " (expected " << expected << ")";
+            }
+            std::cout << "  " << result.time.count() / 1000 << "ms  " << result.nodes_per_second() << " nps\n";
+        }
+    }
+
+    std::cout << "\nTotal: " << total_nodes << " nodes in " << total_time / 1000 << "ms ("
+              << (total_time > 0 ? total_nodes * 1000000 / static_cast<uint64_t>(total_time) : 0) << " nps)\n";
+    std::cout << (all_passed ? "All counts match\n" : "Counts do not match the reference\n");
+    return all_passed;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string fen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+    int depth = 0;
+    bool show_divide = false;
+    bool suite = false;
+    Perft::Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        bool has_value = i + 1 < argc;
+        if (argument == "--help" || argument == "-h") {
+            print_usage(std::cout);
+            return 0;
+        } else if (argument == "--fen" && has_value) {
+            fen = argv[++i];
+        } else if (argument == "--depth" || argument == "--threads" || argument == "--hash") {
+            int value = 0;
+            if (!has_value || !parse_positive(argv[++i], value)) {
+                std::cerr << argument << " needs a whole number of at least 1\n\n";
+                print_usage(std::cerr);
+                return 1;
+            }
+            if (argument == "--depth") {
+                depth = value;
+            } else if (argument == "--threads") {
+                options.threads = value;
+            } else {
+                options.hash_mb = static_cast<size_t>(value);
+            }
+        } else if (argument == "--divide") {
+            show_divide = true;
+        } else if (argument == "--no-bulk") {
+            options.bulk_counting = false;
+        } else if (argument == "--suite") {
+            suite = true;
+        } else {
+            std::cerr << "Unknown argument " << argument << " (see --help)\n";
+            return 1;
+        }
+    }
+
+    Perft perft(options);
+    if (suite) {
+        int max_depth = depth > 0 ? std::min(depth, 6) : 5;
+        return run_suite(perft, max_depth) ? 0 : 1;
+    }
+
+    if (!Board::is_valid_fen(fen)) {
+        std::cerr << "Invalid FEN: " << fen << "\n";
+        return 1;
+    }
+    Board board;
+    board.set_from_fen(fen);
+    Perft::Result result = perft.divide(board, depth > 0 ? depth : 5);
+    if (show_divide) {
+        for (const Perft::DivideEntry& entry : result.divide) {
+            std::cout << entry.move.to_algebraic() << ": " << entry.nodes << "\n";
+        }
+        std::cout << "\nMoves: " << result.divide.size() << "\n";
+    }
+    print_result(result);
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <iostream>
+#include <cstdlib>
+#include <new>
+#include <atomic>
+#include <string>
+#include "../engine/Search.h"
+#include "../engine/Evaluation.h"
+#include "../board/Board.h"
+#include "../board/MoveGenerator.h"
+
+// Global allocation counter, bumped by the replacement operator new below
+static std::atomic<uint64_t> allocation_count{0};
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+class AllocationTester {
+private:
+    int tests_passed = 0;
+    int tests_failed = 0;
+
+    void assert_test(bool condition, const std::string& test_name) {
+        if (condition) {
+            std::cout << "✓ " << test_name << " PASSED\n";
+            tests_passed++;
+        } else {
+            std::cout << "✗ " << test_name << " FAILED\n";
+            tests_failed++;
+        }
+    }
+
+public:
+    void run_all_tests() {
+        std::cout << "=== Heap Allocation Test Suite ===\n\n";
+
+        test_move_generation();
+        test_fixed_depth_search("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 4);
+        test_fixed_depth_search("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 3);
+
+        std::cout << "\n=== TEST SUMMARY ===\n";
+        std::cout << "Tests Passed: " << tests_passed << "\n";
+        std::cout << "Tests Failed: " << tests_failed << "\n";
+    }
+
+    int failures() const { return tests_failed; }
+
+private:
+    void test_move_generation() {
+        std::cout << "Testing move generation paths...\n";
+
+        Board board;
+        board.set_from_fen("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+        MoveGenerator generator;
+
+        uint64_t before = allocation_count.load();
+        MoveList all_moves = generator.generate_all_moves(board);
+        MoveList legal_moves = generator.generate_legal_moves(board);
+        MoveList captures = generator.generate_captures(board);
+        MoveList quiets = generator.generate_quiet_moves(board);
+        uint64_t allocations = allocation_count.load() - before;
+
+        std::cout << "Generated " << all_moves.size() << " pseudo-legal, " << legal_moves.size()
+                  << " legal, " << captures.size() << " captures, " << quiets.size() << " quiet moves\n";
+        assert_test(allocations == 0, "Move generators do not allocate");
+        std::cout << "\n";
+    }
+
+    void test_fixed_depth_search(const std::string& fen, int depth) {
+        std::cout << "Testing depth " << depth << " search from " << fen << "\n";
+
+        Board board;
+        board.set_from_fen(fen);
+        Evaluation evaluation;
+        Search search;
+        search.set_evaluation(&evaluation);
+
+        uint64_t before = allocation_count.load();
+        Search::SearchResult result = search.search_with_stats(board, depth);
+        uint64_t allocations = allocation_count.load() - before;
+
+        std::cout << "Best move: " << result.best_move.to_algebraic()
+                  << ", nodes: " << result.stats.nodes_searched
+                  << ", heap allocations: " << allocations << "\n";
+        assert_test(result.stats.nodes_searched > 0, "Search visited nodes");
+        assert_test(allocations == 0, "Search performs zero heap allocations");
+        std::cout << "\n";
+    }
+};
+
+int main() {
+    AllocationTester tester;
+    tester.run_all_tests();
+    return tester.failures() == 0 ? 0 : 1;
+}
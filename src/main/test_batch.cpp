@@ -0,0 +1,164 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include "../batch/BatchAnalyzer.h"
+#include "../board/MoveGenerator.h"
+
+class BatchTester {
+private:
+    int tests_passed = 0;
+    int tests_failed = 0;
+
+    void assert_test(bool condition, const std::string& test_name) {
+        if (condition) {
+            std::cout << "✓ " << test_name << " PASSED\n";
+            tests_passed++;
+        } else {
+            std::cout << "✗ " << test_name << " FAILED\n";
+            tests_failed++;
+        }
+    }
+
+    static bool is_legal(const std::string& fen, const Move& move) {
+        Board board;
+        board.set_from_fen(fen);
+        MoveGenerator generator;
+        return generator.generate_legal_moves(board).contains(move);
+    }
+
+    const std::vector<std::string> positions = {
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "r1b2k1r/ppp1bppp/8/1B1Q4/5q2/2P5/PPP2PPP/R3R1K1 w - - 1 1",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+        "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    };
+
+public:
+    void run_all_tests() {
+        std::cout << "=== Batch Analysis Test Suite ===\n\n";
+
+        test_analyze();
+        test_streaming();
+        test_throughput();
+
+        std::cout << "\n=== TEST SUMMARY ===\n";
+        std::cout << "Tests Passed: " << tests_passed << "\n";
+        std::cout << "Tests Failed: " << tests_failed << "\n";
+    }
+
+    int failures() const { return tests_failed; }
+
+private:
+    void test_analyze() {
+        std::cout << "Testing a list of positions...\n";
+
+        std::vector<std::string> fens = positions;
+        fens.push_back("8/8/8/8/8/8/8/8 w - - 0 1");
+        BatchAnalyzer::Options options;
+        options.workers = 3;
+        options.hash_mb = 4;
+        options.default_limits.depth = 4;
+        std::vector<BatchAnalyzer::Analysis> analyses = BatchAnalyzer::analyze(fens, options);
+
+        bool in_order = analyses.size() == fens.size();
+        bool all_legal = true;
+        for (size_t i = 0; i + 1 < analyses.size(); ++i) {
+            in_order &= analyses[i].index == i && analyses[i].fen == fens[i];
+            // A forced mate ends the iterations before the depth limit
+            all_legal &= analyses[i].valid && analyses[i].result.depth <= 4 &&
+                         is_legal(fens[i], analyses[i].result.best_move);
+        }
+        assert_test(in_order, "Results come back in input order");
+        assert_test(all_legal, "Every position gets a legal move within the depth limit");
+        assert_test(analyses[2].result.best_move.to_algebraic() == "d5d8" && analyses[2].result.mate_in == 2,
+                    "Batch search finds the mate");
+        assert_test(!analyses.back().valid && BatchAnalyzer::format(analyses.back()) == "6 error invalid fen",
+                    "Invalid FEN is reported, not searched");
+        std::cout << BatchAnalyzer::format(analyses[2]) << "\n";
+        std::cout << "\n";
+    }
+
+    void test_streaming() {
+        std::cout << "Testing streamed input with per-position limits...\n";
+
+        std::istringstream input("# game review\n"
+                                 "\n"
+                                 + positions[1] + " ; movetime 300\n"
+                                 + positions[0] + " ; depth 2\n"
+                                 + positions[3] + "\n"
+                                 + positions[4] + " ; nodes 5000\n");
+        std::vector<BatchAnalyzer::Analysis> completed;
+        BatchAnalyzer::Options options;
+        options.workers = 2;
+        options.hash_mb = 4;
+        options.default_limits.depth = 3;
+        BatchAnalyzer analyzer(options, [&completed](const BatchAnalyzer::Analysis& analysis) {
+            completed.push_back(analysis);
+        });
+        analyzer.run(input);
+
+        std::vector<int> depths(4, -1);
+        std::vector<uint64_t> nodes(4, 0);
+        std::string order;
+        for (const auto& analysis : completed) {
+            depths[analysis.index] = analysis.result.depth;
+            nodes[analysis.index] = analysis.result.stats.nodes_searched;
+            order += std::to_string(analysis.index);
+        }
+        std::cout << "Completion order: " << order << "\n";
+        assert_test(completed.size() == 4, "Comments and blank lines are skipped");
+        assert_test(depths[1] == 2 && depths[2] == 3, "Per-line limits override the defaults");
+        assert_test(nodes[3] <= 5000 + TimeManager::NODES_BETWEEN_POLLS, "Node limit of a line is kept");
+        assert_test(order.find('0') > order.find('1'), "Results stream in completion order");
+        std::cout << "\n";
+    }
+
+    void test_throughput() {
+        std::cout << "Testing throughput with one and with several workers...\n";
+        using std::chrono::steady_clock;
+
+        std::vector<std::string> fens;
+        for (int i = 0; i < 4; ++i) {
+            fens.insert(fens.end(), positions.begin(), positions.end());
+        }
+        BatchAnalyzer::Options options;
+        options.hash_mb = 4;
+        options.default_limits.depth = 5;
+
+        options.workers = 1;
+        auto start = steady_clock::now();
+        std::vector<BatchAnalyzer::Analysis> serial = BatchAnalyzer::analyze(fens, options);
+        auto serial_time = std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start);
+
+        options.workers = 0;
+        start = steady_clock::now();
+        std::vector<BatchAnalyzer::Analysis> parallel = BatchAnalyzer::analyze(fens, options);
+        auto parallel_time = std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start);
+
+        bool complete = serial.size() == fens.size() && parallel.size() == fens.size();
+        for (size_t i = 0; complete && i < fens.size(); ++i) {
+            complete &= parallel[i].index == i && is_legal(fens[i], parallel[i].result.best_move);
+        }
+        assert_test(complete, "Every position is analysed by the full pool");
+
+        unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+        std::cout << fens.size() << " positions: 1 worker " << serial_time.count() << "ms, " << cores
+                  << " workers " << parallel_time.count() << "ms (speed-up "
+                  << static_cast<double>(serial_time.count()) / std::max<long long>(1, parallel_time.count())
+                  << ")\n";
+        std::cout << "\n";
+    }
+};
+
+int main() {
+    BatchTester tester;
+    tester.run_all_tests();
+    return tester.failures() == 0 ? 0 : 1;
+}
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <chrono>
 #include <iomanip>
+#include <stdexcept>
+#include <cstdlib>
 
 void test_bitboard_utils() {
     std::cout << "=== Testing Bitboard Utils ===\n";
@@ -37,6 +39,51 @@ void test_bitboard_utils() {
     BitboardUtils::print_bitboard(rook_attacks);
 }
 
+void test_line_tables() {
+    std::cout << "\n=== Testing Between/Line Tables ===\n";
+    
+    int mismatches = 0;
+    for (int sq1 = 0; sq1 < 64; sq1++) {
+        for (int sq2 = 0; sq2 < 64; sq2++) {
+            int rank_delta = BitboardUtils::get_rank(sq2) - BitboardUtils::get_rank(sq1);
+            int file_delta = BitboardUtils::get_file(sq2) - BitboardUtils::get_file(sq1);
+            bool is_aligned = sq1 != sq2 &&
+                              (rank_delta == 0 || file_delta == 0 || std::abs(rank_delta) == std::abs(file_delta));
+            
+            // Walk the ray by hand: between stops short of sq2, line runs edge to edge
+            Bitboard expected_between = 0;
+            Bitboard expected_line = 0;
+            if (is_aligned) {
+                int rank_dir = (rank_delta > 0) - (rank_delta < 0);
+                int file_dir = (file_delta > 0) - (file_delta < 0);
+                for (int step = 1; sq1 + step * (rank_dir * 8 + file_dir) != sq2; step++) {
+                    BitboardUtils::set_bit(expected_between, sq1 + step * (rank_dir * 8 + file_dir));
+                }
+                for (int step = -7; step <= 7; step++) {
+                    int rank = BitboardUtils::get_rank(sq1) + step * rank_dir;
+                    int file = BitboardUtils::get_file(sq1) + step * file_dir;
+                    if (rank >= 0 && rank < 8 && file >= 0 && file < 8) {
+                        BitboardUtils::set_bit(expected_line, BitboardUtils::square_index(rank, file));
+                    }
+                }
+            }
+            
+            if (BitboardUtils::between_squares(sq1, sq2) != expected_between ||
+                BitboardUtils::line_through(sq1, sq2) != expected_line) {
+                mismatches++;
+            }
+        }
+    }
+    
+    std::cout << (mismatches == 0 ? "✓ " : "✗ ") << "4096 square pairs checked, " << mismatches << " mismatches\n";
+    std::cout << "Aligned a1-d4-h8: " << BitboardUtils::aligned(A1, D4, H8)
+              << ", a1-d4-h7: " << BitboardUtils::aligned(A1, D4, H7) << "\n";
+    
+    if (mismatches != 0 || !BitboardUtils::aligned(A1, D4, H8) || BitboardUtils::aligned(A1, D4, H7)) {
+        throw std::runtime_error("between/line tables disagree with ray geometry");
+    }
+}
+
 void test_bitboard_board() {
     std::cout << "\n=== Testing Bitboard Board ===\n";
     
@@ -69,7 +116,7 @@ void test_move_generation() {
     board.set_starting_position();
     
     auto start = std::chrono::high_resolution_clock::now();
-    std::vector<Move> moves = generator.generate_all_moves(board);
+    MoveList moves = generator.generate_all_moves(board);
     auto end = std::chrono::high_resolution_clock::now();
     
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
@@ -80,17 +127,17 @@ void test_move_generation() {
     std::cout << "\nFirst 10 moves:\n";
     for (size_t i = 0; i < std::min(moves.size(), static_cast<size_t>(10)); i++) {
         const Move& move = moves[i];
-        char from_file = 'a' + move.from_file;
-        char to_file = 'a' + move.to_file;
-        std::cout << move.piece << ": " << from_file << (move.from_rank + 1) 
-                  << " -> " << to_file << (move.to_rank + 1);
-        if (move.promotion_piece != '.') {
-            std::cout << "=" << move.promotion_piece;
+        char from_file = 'a' + move.from_file();
+        char to_file = 'a' + move.to_file();
+        std::cout << move.piece() << ": " << from_file << (move.from_rank() + 1) 
+                  << " -> " << to_file << (move.to_rank() + 1);
+        if (move.promotion_piece() != '.') {
+            std::cout << "=" << move.promotion_piece();
         }
-        if (move.is_castling) {
+        if (move.is_castling()) {
             std::cout << " (castling)";
         }
-        if (move.is_en_passant) {
+        if (move.is_en_passant()) {
             std::cout << " (en passant)";
         }
         std::cout << "\n";
@@ -106,7 +153,7 @@ void test_legal_moves() {
     board.set_starting_position();
     
     auto start = std::chrono::high_resolution_clock::now();
-    std::vector<Move> legal_moves = generator.generate_legal_moves(board);
+    MoveList legal_moves = generator.generate_legal_moves(board);
     auto end = std::chrono::high_resolution_clock::now();
     
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
@@ -123,6 +170,170 @@ void test_legal_moves() {
     std::cout << "Legal moves: " << legal_moves.size() << "\n";
 }
 
+// Count leaf nodes of the legal move tree
+uint64_t perft(Board& board, MoveGenerator& generator, int depth) {
+    MoveList moves = generator.generate_legal_moves(board);
+    if (depth == 1) return moves.size();
+    
+    uint64_t nodes = 0;
+    for (const Move& move : moves) {
+        BitboardMoveUndoData undo_data = board.apply_move(move);
+        nodes += perft(board, generator, depth - 1);
+        board.undo_move(undo_data);
+    }
+    return nodes;
+}
+
+void test_perft() {
+    std::cout << "\n=== Testing Legal Move Generation (Perft) ===\n";
+    
+    struct PerftCase {
+        const char* fen;
+        int depth;
+        uint64_t nodes;
+    };
+    
+    // Reference counts from the standard perft suite
+    const PerftCase cases[] = {
+        {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 4, 197281},
+        {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 3, 97862},
+        {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 5, 674624},
+        {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 4, 422333},
+        {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 3, 62379},
+        {"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 3, 89890}
+    };
+    
+    Board board;
+    MoveGenerator generator;
+    bool all_passed = true;
+    
+    for (const PerftCase& test_case : cases) {
+        board.set_from_fen(test_case.fen);
+        
+        auto start = std::chrono::high_resolution_clock::now();
+        uint64_t nodes = perft(board, generator, test_case.depth);
+        auto end = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        
+        bool passed = (nodes == test_case.nodes);
+        all_passed &= passed;
+        std::cout << (passed ? "✓ " : "✗ ") << "perft(" << test_case.depth << ") = " << nodes
+                  << " (expected " << test_case.nodes << ", " << duration.count() << " ms) " << test_case.fen << "\n";
+    }
+    
+    if (!all_passed) {
+        throw std::runtime_error("perft node counts do not match the reference values");
+    }
+}
+
+void test_evasions() {
+    std::cout << "\n=== Testing Check Evasions ===\n";
+    
+    struct EvasionCase {
+        const char* fen;
+        const char* description;
+        bool double_check;
+    };
+    
+    const EvasionCase cases[] = {
+        {"4k3/8/8/8/8/5n2/8/4r1K1 w - - 0 1", "Rook and knight double check", true},
+        {"4k3/8/8/8/1b6/8/8/RN2K2R w KQ - 0 1", "Bishop check: block, capture or step aside", false},
+        {"4k3/8/8/8/8/3n4/8/R3K2R w KQ - 0 1", "Knight check cannot be blocked", false},
+        {"8/8/8/2k5/3Pp3/8/8/4K3 b - d3 0 1", "Pawn check answered by en passant", false},
+        {"8/8/8/4k3/3Pp3/8/8/4RK2 b - d3 0 1", "En passant would expose the king on the file", false}
+    };
+    
+    Board board;
+    MoveGenerator generator;
+    bool all_passed = true;
+    
+    for (const EvasionCase& test_case : cases) {
+        board.set_from_fen(test_case.fen);
+        MoveList evasions = generator.generate_evasions(board);
+        
+        // Reference: every pseudo-legal move that passes the single-move legality check
+        MoveList reference;
+        for (const Move& move : generator.generate_all_moves(board)) {
+            if (board.is_move_legal(move)) reference.push_back(move);
+        }
+        
+        bool passed = board.is_in_check(board.get_active_color()) && evasions.size() == reference.size();
+        for (const Move& move : evasions) {
+            passed &= reference.contains(move);
+            if (test_case.double_check) passed &= (move.piece_type() == Board::KING);
+        }
+        all_passed &= passed;
+        std::cout << (passed ? "✓ " : "✗ ") << test_case.description << ": " << evasions.size() << " evasions\n";
+    }
+    
+    if (!all_passed) {
+        throw std::runtime_error("check evasions do not match the legal move set");
+    }
+}
+
+void test_static_exchange() {
+    std::cout << "\n=== Testing Static Exchange Evaluation ===\n";
+    
+    struct ExchangeCase {
+        const char* fen;
+        const char* move;
+        int expected;
+    };
+    
+    const ExchangeCase cases[] = {
+        {"1k1r4/1pp4p/p7/4p3/8/P5P1/1PP4P/2K1R3 w - - 0 1", "e1e5", 100},            // Undefended pawn
+        {"1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1", "d3e5", -225},  // X-rays on both sides
+        {"4k3/2p5/3p4/8/8/8/3Q4/4K3 w - - 0 1", "d2d6", -875},                       // Queen takes a defended pawn
+        {"4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1", "e5d6", 100},                          // En passant
+        {"4k3/1P6/8/8/8/8/8/4K3 w - - 0 1", "b7b8q", 875},                           // Promotion
+        {"3rk3/8/8/3p4/8/8/8/3RK3 w - - 0 1", "d1d5", -400}                          // Rook for a pawn
+    };
+    
+    Board board;
+    MoveGenerator generator;
+    bool all_passed = true;
+    
+    for (const ExchangeCase& test_case : cases) {
+        board.set_from_fen(test_case.fen);
+        Move move;
+        for (const Move& legal : generator.generate_legal_moves(board)) {
+            if (legal.to_algebraic() == test_case.move) move = legal;
+        }
+        
+        int value = move.is_null() ? 0 : generator.see(board, move);
+        bool passed = !move.is_null() && value == test_case.expected &&
+                      generator.see_ge(board, move, value) && !generator.see_ge(board, move, value + 1);
+        all_passed &= passed;
+        std::cout << (passed ? "✓ " : "✗ ") << test_case.move << ": SEE " << value
+                  << " (expected " << test_case.expected << ")\n";
+    }
+    
+    // The early-exit test must agree with the full exchange at every threshold
+    const char* fens[] = {
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+        "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8"
+    };
+    int disagreements = 0;
+    int checked = 0;
+    for (const char* fen : fens) {
+        board.set_from_fen(fen);
+        for (const Move& move : generator.generate_legal_moves(board)) {
+            int value = generator.see(board, move);
+            for (int threshold = -1000; threshold <= 1000; threshold += 25) {
+                disagreements += generator.see_ge(board, move, threshold) != (value >= threshold);
+                checked++;
+            }
+        }
+    }
+    std::cout << (disagreements == 0 ? "✓ " : "✗ ") << checked << " see_ge thresholds checked, "
+              << disagreements << " disagreements\n";
+    
+    if (!all_passed || disagreements != 0) {
+        throw std::runtime_error("static exchange evaluation is wrong");
+    }
+}
+
 void performance_test() {
     std::cout << "\n=== Performance Test ===\n";
     
@@ -137,7 +348,7 @@ void performance_test() {
     
     long long total_moves = 0;
     for (int i = 0; i < iterations; i++) {
-        std::vector<Move> moves = generator.generate_all_moves(board);
+        MoveList moves = generator.generate_all_moves(board);
         total_moves += moves.size();
     }
     
@@ -185,9 +396,13 @@ int main() {
     
     try {
         test_bitboard_utils();
+        test_line_tables();
         test_bitboard_board();
         test_move_generation();
         test_legal_moves();
+        test_perft();
+        test_evasions();
+        test_static_exchange();
         test_attack_detection();
         performance_test();
         
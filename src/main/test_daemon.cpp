@@ -0,0 +1,163 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <chrono>
+#include <thread>
+#include "../daemon/Daemon.h"
+
+class DaemonTester {
+private:
+    int tests_passed = 0;
+    int tests_failed = 0;
+
+    void assert_test(bool condition, const std::string& test_name) {
+        if (condition) {
+            std::cout << "✓ " << test_name << " PASSED\n";
+            tests_passed++;
+        } else {
+            std::cout << "✗ " << test_name << " FAILED\n";
+            tests_failed++;
+        }
+    }
+
+    static bool contains(const std::string& text, const std::string& part) {
+        return text.find(part) != std::string::npos;
+    }
+
+    static int count_lines(const std::string& text) {
+        int lines = 0;
+        for (char c : text) {
+            lines += c == '\n';
+        }
+        return lines;
+    }
+
+    static Daemon::Options small_pool(int workers) {
+        Daemon::Options options;
+        options.workers = workers;
+        options.hash_mb = 4;
+        return options;
+    }
+
+public:
+    void run_all_tests() {
+        std::cout << "=== Engine Daemon Test Suite ===\n\n";
+
+        test_commands_and_errors();
+        test_concurrent_requests();
+        test_cancel();
+        test_session();
+
+        std::cout << "\n=== TEST SUMMARY ===\n";
+        std::cout << "Tests Passed: " << tests_passed << "\n";
+        std::cout << "Tests Failed: " << tests_failed << "\n";
+    }
+
+    int failures() const { return tests_failed; }
+
+private:
+    void test_commands_and_errors() {
+        std::cout << "Testing commands and malformed requests...\n";
+
+        std::ostringstream output;
+        Daemon daemon(output, small_pool(1));
+        daemon.submit("{\"cmd\": \"ping\", \"id\": 7}");
+        daemon.submit("{\"id\": 1, \"fen\": ");
+        daemon.submit("{\"id\": 2, \"fen\": \"8/8/8/8/8/8/8/8 w - - 0 1\"}");
+        daemon.submit("{\"id\": 5, \"fen\": \"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBN1 w KQkq - 0 1\"}");
+        daemon.submit("{\"id\": 3, \"moves\": [\"e2e4\", \"e2e4\"], \"depth\": 2}");
+        bool answered_at_once = contains(output.str(), "{\"id\":3,\"status\":\"error\",\"error\":\"illegal move e2e4\"}");
+        daemon.submit("{\"id\": 4, \"depth\": -1}");
+        daemon.submit("{\"id\": \"x\", \"cmd\": \"cancel\"}");
+        daemon.drain();
+
+        std::string text = output.str();
+        std::cout << text;
+        assert_test(contains(text, "{\"id\":7,\"status\":\"pong\"}"), "ping is answered");
+        assert_test(contains(text, "{\"id\":null,\"status\":\"error\""), "Malformed JSON is an error");
+        assert_test(contains(text, "{\"id\":2,\"status\":\"error\",\"error\":\"invalid fen\"}"), "Invalid FEN is rejected");
+        assert_test(contains(text, "{\"id\":5,\"status\":\"error\",\"error\":\"invalid fen\"}"),
+                    "Castling right without its rook is rejected");
+        assert_test(answered_at_once, "Illegal move is rejected before queuing");
+        assert_test(contains(text, "{\"id\":4,\"status\":\"error\""), "Negative limit is rejected");
+        assert_test(contains(text, "{\"id\":\"x\",\"status\":\"error\",\"error\":\"no such request\"}"),
+                    "Cancelling an unknown request is an error");
+        std::cout << "\n";
+    }
+
+    void test_concurrent_requests() {
+        std::cout << "Testing many requests in flight...\n";
+
+        std::ostringstream output;
+        Daemon daemon(output, small_pool(3));
+        const char* fens[] = {
+            "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+            "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+            "r1b2k1r/ppp1bppp/8/1B1Q4/5q2/2P5/PPP2PPP/R3R1K1 w - - 1 1",
+            "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        };
+        for (int i = 0; i < 8; ++i) {
+            daemon.submit("{\"id\": \"r" + std::to_string(i) + "\", \"fen\": \"" + fens[i % 4] + "\", \"depth\": 5}");
+        }
+        daemon.drain();
+
+        std::string text = output.str();
+        bool all_answered = true;
+        for (int i = 0; i < 8; ++i) {
+            all_answered &= contains(text, "{\"id\":\"r" + std::to_string(i) + "\",\"status\":\"ok\"");
+        }
+        assert_test(daemon.worker_count() == 3, "Pool has the requested size");
+        assert_test(all_answered && count_lines(text) == 8, "Every request gets exactly one reply");
+        assert_test(contains(text, "\"bestmove\":\"d5d8\",\"ponder\":\"e7d8\",\"score\":{\"mate\":2}"),
+                    "Reply carries move, ponder move and score");
+        std::cout << "\n";
+    }
+
+    void test_cancel() {
+        std::cout << "Testing cancellation...\n";
+
+        std::ostringstream output;
+        Daemon daemon(output, small_pool(1));
+        auto start = std::chrono::steady_clock::now();
+        daemon.submit("{\"id\": \"long\", \"movetime\": 10000}");
+        daemon.submit("{\"id\": \"queued\", \"movetime\": 10000}");
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        daemon.submit("{\"cmd\": \"cancel\", \"id\": \"queued\"}");
+        daemon.submit("{\"cmd\": \"cancel\", \"id\": \"long\"}");
+        daemon.drain();
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        std::string text = output.str();
+        std::cout << text;
+        assert_test(contains(text, "{\"id\":\"queued\",\"status\":\"cancelled\"}"), "Queued request is dropped");
+        assert_test(contains(text, "{\"id\":\"long\",\"status\":\"cancelled\",\"bestmove\":\""),
+                    "Running request stops with its best move so far");
+        assert_test(elapsed < std::chrono::milliseconds(1000), "Cancelled searches do not run out their time");
+        std::cout << "\n";
+    }
+
+    void test_session() {
+        std::cout << "Testing a scripted session...\n";
+
+        std::istringstream input("{\"id\": 1, \"moves\": [\"e2e4\"], \"nodes\": 20000}\n"
+                                 "\n"
+                                 "{\"id\": 2, \"fen\": \"8/8/8/8/8/8/5k2/7K b - - 0 1\", \"depth\": 3}\n"
+                                 "{\"cmd\": \"quit\"}\n"
+                                 "{\"id\": 3, \"depth\": 1}\n");
+        std::ostringstream output;
+        Daemon daemon(output, small_pool(2));
+        daemon.run(input);
+
+        std::string text = output.str();
+        assert_test(contains(text, "{\"id\":1,\"status\":\"ok\"") && contains(text, "{\"id\":2,\"status\":\"ok\""),
+                    "Requests before quit are answered");
+        assert_test(!contains(text, "\"id\":3"), "Nothing after quit is read");
+        std::cout << "\n";
+    }
+};
+
+int main() {
+    DaemonTester tester;
+    tester.run_all_tests();
+    return tester.failures() == 0 ? 0 : 1;
+}
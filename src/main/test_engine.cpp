@@ -0,0 +1,119 @@
+#include <iostream>
+#include <string>
+#include <chrono>
+#include "../engine/Engine.h"
+#include "../engine/Search.h"
+#include "../board/MoveGenerator.h"
+
+class EngineTester {
+private:
+    int tests_passed = 0;
+    int tests_failed = 0;
+
+    void assert_test(bool condition, const std::string& test_name) {
+        if (condition) {
+            std::cout << "✓ " << test_name << " PASSED\n";
+            tests_passed++;
+        } else {
+            std::cout << "✗ " << test_name << " FAILED\n";
+            tests_failed++;
+        }
+    }
+
+    bool is_legal(const Engine& engine, const Move& move) {
+        Board board = engine.get_board();
+        MoveGenerator generator;
+        return generator.generate_legal_moves(board).contains(move);
+    }
+
+public:
+    void run_all_tests() {
+        std::cout << "=== Engine Test Suite ===\n\n";
+
+        test_positions();
+        test_search_variants();
+        test_persistent_state();
+
+        std::cout << "\n=== TEST SUMMARY ===\n";
+        std::cout << "Tests Passed: " << tests_passed << "\n";
+        std::cout << "Tests Failed: " << tests_failed << "\n";
+    }
+
+    int failures() const { return tests_failed; }
+
+private:
+    void test_positions() {
+        std::cout << "Testing position management...\n";
+
+        Engine engine;
+        assert_test(engine.get_board().to_fen() == Engine::START_FEN, "Engine starts from the initial position");
+        assert_test(engine.make_move("e2e4") && engine.make_move("c7c5"), "Legal moves are played");
+        assert_test(!engine.make_move("e4e6"), "Illegal move is rejected");
+        assert_test(engine.get_current_position() ==
+                        "rnbqkbnr/pp1ppppp/8/2p5/4P3/8/PPPP1PPP/RNBQKBNR w KQkq c6 0 2",
+                    "Current position follows the moves");
+
+        engine.set_position("8/P7/8/8/8/8/8/k6K w - - 0 1");
+        assert_test(engine.parse_move("a7a8n").is_promotion() && engine.parse_move("a7a8").is_null(),
+                    "Promotions need their piece letter");
+        std::cout << "\n";
+    }
+
+    void test_search_variants() {
+        std::cout << "Testing depth, time and node limited searches...\n";
+        using std::chrono::milliseconds;
+
+        Engine engine;
+        engine.set_position("r1b2k1r/ppp1bppp/8/1B1Q4/5q2/2P5/PPP2PPP/R3R1K1 w - - 1 1");
+        Search::SearchResult mate = engine.get_best_move(4);
+        assert_test(mate.best_move.to_algebraic() == "d5d8" && mate.is_mate && mate.mate_in == 2,
+                    "Depth-limited search returns the full result");
+
+        engine.set_position("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+        Search::SearchResult timed = engine.get_best_move_timed(milliseconds(100));
+        assert_test(is_legal(engine, timed.best_move) && timed.stats.time_elapsed < milliseconds(200),
+                    "Time-limited search");
+
+        Search::SearchResult counted = engine.get_best_move_nodes(20000);
+        assert_test(is_legal(engine, counted.best_move) &&
+                        counted.stats.nodes_searched <= 20000 + TimeManager::NODES_BETWEEN_POLLS,
+                    "Node-limited search");
+
+        Search::SearchLimits limits;
+        limits.depth = 3;
+        limits.nodes = 1000000;
+        Search::SearchResult combined = engine.get_best_move(limits);
+        assert_test(combined.depth == 3, "Combined limits stop at the first one reached");
+
+        std::cout << "Timed: depth " << timed.depth << " in " << timed.stats.time_elapsed.count()
+                  << "ms; 20000 nodes: depth " << counted.depth << " (" << counted.stats.nodes_searched << " nodes)\n";
+        std::cout << "\n";
+    }
+
+    void test_persistent_state() {
+        std::cout << "Testing warm state across calls...\n";
+
+        // The second search of a game position starts from the first one's table
+        Engine engine;
+        engine.set_position("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+        Search::SearchResult cold = engine.get_best_move(6);
+        Search::SearchResult warm = engine.get_best_move(6);
+        assert_test(warm.stats.nodes_searched < cold.stats.nodes_searched,
+                    "Repeated search reuses the transposition table");
+        assert_test(warm.best_move == cold.best_move, "Repeated search agrees on the move");
+
+        engine.new_game();
+        Search::SearchResult fresh = engine.get_best_move(6);
+        assert_test(fresh.stats.nodes_searched > warm.stats.nodes_searched, "new_game() clears the warm state");
+
+        std::cout << "Nodes cold: " << cold.stats.nodes_searched << ", warm: " << warm.stats.nodes_searched
+                  << ", after new_game: " << fresh.stats.nodes_searched << "\n";
+        std::cout << "\n";
+    }
+};
+
+int main() {
+    EngineTester tester;
+    tester.run_all_tests();
+    return tester.failures() == 0 ? 0 : 1;
+}
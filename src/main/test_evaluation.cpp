@@ -1122,7 +1122,7 @@ void test_incremental_evaluation_detailed() {
     
     for (const auto& move_str : test_moves) {
         // Generate legal moves to find the move
-        std::vector<Move> legal_moves = move_gen.generate_legal_moves(board);
+        MoveList legal_moves = move_gen.generate_legal_moves(board);
         
         Move test_move;
         bool move_found = false;
@@ -1136,10 +1136,10 @@ void test_incremental_evaluation_detailed() {
                 char to_file = move_str[2];
                 char to_rank = move_str[3];
                 
-                if (move.from_file == from_file - 'a' && 
-                    move.from_rank == from_rank - '1' &&
-                    move.to_file == to_file - 'a' && 
-                    move.to_rank == to_rank - '1') {
+                if (move.from_file() == from_file - 'a' && 
+                    move.from_rank() == from_rank - '1' &&
+                    move.to_file() == to_file - 'a' && 
+                    move.to_rank() == to_rank - '1') {
                     test_move = move;
                     move_found = true;
                     break;
@@ -1310,7 +1310,7 @@ void test_move_evaluations() {
         std::cout << "Base position evaluation: " << base_eval << " cp" << std::endl;
 
         // Generate all legal moves
-        std::vector<Move> legal_moves = move_gen.generate_legal_moves(board);
+        MoveList legal_moves = move_gen.generate_legal_moves(board);
         std::cout << "Legal moves found: " << legal_moves.size() << std::endl;
         
         if (legal_moves.empty()) {
@@ -1359,15 +1359,15 @@ void test_move_evaluations() {
             
             // Add move type information
             if (move.is_capture()) {
-                std::cout << " [Capture: " << move.captured_piece << "]";
+                std::cout << " [Capture: " << move.captured_piece() << "]";
             }
             if (move.is_promotion()) {
-                std::cout << " [Promotion: " << move.promotion_piece << "]";
+                std::cout << " [Promotion: " << move.promotion_piece() << "]";
             }
-            if (move.is_castling) {
+            if (move.is_castling()) {
                 std::cout << " [Castling]";
             }
-            if (move.is_en_passant) {
+            if (move.is_en_passant()) {
                 std::cout << " [En Passant]";
             }
             
@@ -1442,7 +1442,7 @@ void test_custom_fen_move_evaluations() {
             std::cout << "Position evaluation: " << base_eval << " cp" << std::endl;
             
             // Generate and evaluate moves
-            std::vector<Move> legal_moves = move_gen.generate_legal_moves(board);
+            MoveList legal_moves = move_gen.generate_legal_moves(board);
             std::cout << "Legal moves: " << legal_moves.size() << std::endl;
             
             if (!legal_moves.empty()) {
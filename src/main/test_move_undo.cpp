@@ -56,6 +56,8 @@ public:
         test_game_state_preservation();
         test_move_sequences_after_undo();
         test_illegal_moves();
+        test_zobrist_keys();
+        test_fast_legality();
         
         print_summary();
     }
@@ -361,7 +363,7 @@ public:
         Board original = board;
 
         MoveGenerator generator;
-        std::vector<Move> legal_moves = generator.generate_legal_moves(board);
+        MoveList legal_moves = generator.generate_legal_moves(board);
         for (auto move : legal_moves) {
             std::cout << move.to_algebraic() << std::endl;
         }
@@ -523,6 +525,121 @@ public:
         std::cout << "\n--- Move Sequences After Undo Test Complete ---\n";
     }
     
+    // Walk the move tree, checking the incremental keys against a full rehash
+    bool zobrist_walk(int depth) {
+        if (board.get_hash_key() != board.compute_hash_key() ||
+            board.get_pawn_key() != board.compute_pawn_key()) {
+            std::cout << "Key mismatch at " << board.to_fen() << "\n";
+            return false;
+        }
+        if (depth == 0) return true;
+        
+        MoveList moves = generator.generate_legal_moves(board);
+        for (const Move& move : moves) {
+            uint64_t key_before = board.get_hash_key();
+            uint64_t pawn_key_before = board.get_pawn_key();
+            BitboardMoveUndoData undo_data = board.apply_move(move);
+            bool ok = zobrist_walk(depth - 1);
+            board.undo_move(undo_data);
+            if (!ok) return false;
+            if (board.get_hash_key() != key_before || board.get_pawn_key() != pawn_key_before) {
+                std::cout << "Key not restored after undoing " << move.to_algebraic() << "\n";
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    void test_zobrist_keys() {
+        std::cout << "\n--- Testing Incremental Zobrist Keys ---\n";
+        
+        const std::vector<std::string> positions = {
+            "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+            "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+            "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+            "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1"
+        };
+        for (const std::string& fen : positions) {
+            board.set_from_fen(fen);
+            assert_test(zobrist_walk(3), "Incremental keys match full rehash: " + fen);
+        }
+        
+        // Transpositions reach the same key, side to move changes it
+        board.set_starting_position();
+        uint64_t start_key = board.get_hash_key();
+        board.make_move(Move(0, 6, 2, 5, 'N')); // Ng1-f3
+        board.make_move(Move(7, 6, 5, 5, 'n')); // Ng8-f6
+        board.make_move(Move(2, 5, 0, 6, 'N')); // Nf3-g1
+        board.make_move(Move(5, 5, 7, 6, 'n')); // Nf6-g8
+        assert_test(board.get_hash_key() == start_key, "Knight shuffle transposes to the start key");
+        
+        Board other;
+        other.set_from_fen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR b KQkq - 0 1");
+        assert_test(other.get_hash_key() != start_key, "Side to move changes the key");
+        assert_test(other.get_pawn_key() == board.get_pawn_key(), "Pawn key ignores pieces and side to move");
+    }
+    
+    // Reference legality: generated pseudo-legally and the king is safe afterwards
+    bool reference_legal(const MoveList& pseudo_moves, const Move& move) {
+        if (!pseudo_moves.contains(move)) return false;
+        Board::Color mover = board.get_active_color();
+        BitboardMoveUndoData undo_data = board.apply_move(move);
+        bool safe = !board.is_in_check(mover);
+        board.undo_move(undo_data);
+        return safe;
+    }
+    
+    // Compare Board::is_move_legal with the reference over a move tree, also
+    // feeding each child the parent's moves as foreign candidates
+    bool legality_walk(int depth, const MoveList& foreign) {
+        MoveList pseudo_moves = generator.generate_all_moves(board);
+        auto matches_reference = [&](const MoveList& candidates) {
+            for (const Move& move : candidates) {
+                if (board.is_move_legal(move) != reference_legal(pseudo_moves, move)) {
+                    std::cout << "Legality mismatch for " << move.to_algebraic() << " at " << board.to_fen() << "\n";
+                    return false;
+                }
+            }
+            return true;
+        };
+        if (!matches_reference(pseudo_moves) || !matches_reference(foreign)) return false;
+        if (depth == 0) return true;
+        
+        for (const Move& move : pseudo_moves) {
+            if (!reference_legal(pseudo_moves, move)) continue;
+            BitboardMoveUndoData undo_data = board.apply_move(move);
+            bool ok = legality_walk(depth - 1, pseudo_moves);
+            board.undo_move(undo_data);
+            if (!ok) return false;
+        }
+        return true;
+    }
+    
+    void test_fast_legality() {
+        std::cout << "\n--- Testing Constant-Time Legality Check ---\n";
+        
+        const std::vector<std::string> positions = {
+            "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+            "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+            "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+            "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+            "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+            "8/8/8/KPp4r/8/8/8/7k w - c6 0 2"
+        };
+        for (const std::string& fen : positions) {
+            board.set_from_fen(fen);
+            assert_test(legality_walk(2, MoveList()), "is_move_legal matches make/unmake legality: " + fen);
+        }
+        
+        // Hand-built moves that no generator would produce
+        board.set_starting_position();
+        assert_test(!board.is_move_legal(Move(0, 1, 3, 1, 'N')), "Knight cannot jump like a rook");
+        assert_test(!board.is_move_legal(Move(0, 2, 2, 4, 'B')), "Bishop cannot jump over pawns");
+        assert_test(!board.is_move_legal(Move(1, 4, 4, 4, 'P')), "Pawn cannot advance three squares");
+        assert_test(!board.is_move_legal(Move(0, 4, 0, 6, 'K', '.', '.', true)), "Cannot castle through own pieces");
+        assert_test(board.is_move_legal(Move(1, 4, 3, 4, 'P')), "Double pawn push is legal");
+    }
+    
     void test_illegal_moves() {
         std::cout << "\n--- Testing Illegal Moves ---\n";
         
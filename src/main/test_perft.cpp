@@ -0,0 +1,142 @@
+#include <iostream>
+#include <string>
+#include <thread>
+#include "../board/Board.h"
+#include "../board/Perft.h"
+
+class PerftTester {
+private:
+    int tests_passed = 0;
+    int tests_failed = 0;
+
+    void assert_test(bool condition, const std::string& test_name) {
+        if (condition) {
+            std::cout << "✓ " << test_name << " PASSED\n";
+            tests_passed++;
+        } else {
+            std::cout << "✗ " << test_name << " FAILED\n";
+            tests_failed++;
+        }
+    }
+
+    static Board board_from(const char* fen) {
+        Board board;
+        board.set_from_fen(fen);
+        return board;
+    }
+
+public:
+    void run_all_tests() {
+        std::cout << "=== Perft Test Suite ===\n\n";
+
+        test_reference_positions();
+        test_divide();
+        test_counting_variants();
+
+        std::cout << "\n=== TEST SUMMARY ===\n";
+        std::cout << "Tests Passed: " << tests_passed << "\n";
+        std::cout << "Tests Failed: " << tests_failed << "\n";
+    }
+
+    int failures() const { return tests_failed; }
+
+private:
+    void test_reference_positions() {
+        std::cout << "Testing the reference positions...\n";
+
+        // Deepest depth of every position that stays around a million nodes
+        const int depths[] = {4, 3, 5, 4, 3, 3};
+        Perft perft;
+        for (size_t i = 0; i < Perft::REFERENCE_POSITIONS.size(); ++i) {
+            const Perft::ReferencePosition& position = Perft::REFERENCE_POSITIONS[i];
+            Board board = board_from(position.fen);
+            bool all_depths = true;
+            for (int depth = 1; depth <= depths[i]; ++depth) {
+                all_depths &= perft.count(board, depth) == position.nodes[depth - 1];
+            }
+            assert_test(all_depths, std::string(position.name) + " up to depth " + std::to_string(depths[i]));
+        }
+        std::cout << "\n";
+    }
+
+    void test_divide() {
+        std::cout << "Testing divide...\n";
+
+        Perft perft;
+        Board start = board_from(Perft::REFERENCE_POSITIONS[0].fen);
+        Perft::Result result = perft.divide(start, 3);
+        uint64_t sum = 0;
+        bool e2e4_found = false;
+        for (const Perft::DivideEntry& entry : result.divide) {
+            sum += entry.nodes;
+            e2e4_found |= entry.move.to_algebraic() == "e2e4" && entry.nodes == 600;
+        }
+        assert_test(result.divide.size() == 20 && sum == result.nodes && result.nodes == 8902,
+                    "Root move counts add up to the total");
+        assert_test(e2e4_found, "Count below e2e4 matches the reference divide");
+
+        Board kiwipete = board_from(Perft::REFERENCE_POSITIONS[1].fen);
+        MoveGenerator generator;
+        MoveList ordered = generator.generate_legal_moves(kiwipete);
+        MoveList unordered = generator.generate_legal_moves_unordered(kiwipete);
+        bool same_moves = ordered.size() == unordered.size();
+        for (const Move& move : unordered) {
+            same_moves &= ordered.contains(move);
+        }
+        assert_test(same_moves, "Unordered generation finds the same legal moves");
+
+        Perft::Result leaf = perft.divide(start, 0);
+        assert_test(leaf.nodes == 1 && leaf.divide.empty(), "Depth 0 counts the position itself");
+        assert_test(start.to_fen() == Perft::REFERENCE_POSITIONS[0].fen, "Counting leaves the board unchanged");
+        std::cout << "\n";
+    }
+
+    void test_counting_variants() {
+        std::cout << "Testing table, threads and counting without bulk...\n";
+
+        const Perft::ReferencePosition& kiwipete = Perft::REFERENCE_POSITIONS[1];
+        Board board = board_from(kiwipete.fen);
+
+        Perft::Options plain_options;
+        Perft plain(plain_options);
+        Perft::Result reference = plain.divide(board, 4);
+
+        Perft::Options hash_options;
+        hash_options.hash_mb = 16;
+        Perft hashed(hash_options);
+        Perft::Result first = hashed.divide(board, 4);
+        Perft::Result second = hashed.divide(board, 4);
+        assert_test(reference.nodes == kiwipete.nodes[3] && first.nodes == reference.nodes &&
+                        second.nodes == reference.nodes,
+                    "Counts with the table match counts without");
+        assert_test(second.time < first.time, "Stored counts make a repeated count faster");
+
+        Perft::Options thread_options;
+        thread_options.threads = 4;
+        thread_options.hash_mb = 16;
+        Perft threaded(thread_options);
+        Perft::Result split = threaded.divide(board, 4);
+        bool same_divide = split.divide.size() == reference.divide.size();
+        for (size_t i = 0; same_divide && i < split.divide.size(); ++i) {
+            same_divide = split.divide[i].move == reference.divide[i].move &&
+                          split.divide[i].nodes == reference.divide[i].nodes;
+        }
+        assert_test(split.nodes == reference.nodes && same_divide, "Root split across threads gives the same divide");
+
+        Perft::Options no_bulk_options;
+        no_bulk_options.bulk_counting = false;
+        Perft no_bulk(no_bulk_options);
+        assert_test(no_bulk.count(board, 3) == kiwipete.nodes[2], "Counting by playing every move agrees");
+
+        std::cout << "Kiwipete perft(4): " << reference.nodes_per_second() << " nps, with table "
+                  << first.nodes_per_second() << " nps (repeat " << second.time.count() << "us), "
+                  << thread_options.threads << " threads " << split.nodes_per_second() << " nps\n";
+        std::cout << "\n";
+    }
+};
+
+int main() {
+    PerftTester tester;
+    tester.run_all_tests();
+    return tester.failures() == 0 ? 0 : 1;
+}
@@ -1,8 +1,14 @@
 #include <iostream>
 #include <cassert>
 #include <chrono>
+#include <thread>
+#include <vector>
 #include "../engine/Search.h"
 #include "../engine/Evaluation.h"
+#include "../engine/MoveHistory.h"
+#include "../engine/MovePicker.h"
+#include "../engine/TimeManager.h"
+#include "../engine/TranspositionTable.h"
 #include "../board/Board.h"
 #include "../board/Move.h"
 #include "../board/MoveGenerator.h"
@@ -24,6 +30,17 @@ public:
 
     void run_all_tests() {
         test_basic_minimax();
+        test_move_picker();
+        test_transposition_table();
+        test_quiescence();
+        test_lazy_smp();
+        test_aspiration_windows();
+        test_null_move_pruning();
+        test_late_move_reductions();
+        test_move_history();
+        test_time_manager();
+        test_principal_variation();
+        test_async_search();
         // test_alpha_beta_pruning();
         // test_iterative_deepening();
         // test_mate_detection();
@@ -52,7 +69,7 @@ private:
         // Test with starting position
         board.set_starting_position();
         
-        Search::SearchResult result = search.find_best_move(board, 4);
+        Search::SearchResult result = search.search_with_stats(board, 4);
         
         assert_test(!result.best_move.to_algebraic().empty(), "Returns valid move");
         assert_test(result.depth >= 1, "Search depth is positive");
@@ -65,14 +82,494 @@ private:
         std::cout << "\n";
     }
 
+    void test_move_picker() {
+        std::cout << "Testing Staged Move Picker...\n";
+        
+        const char* fens[] = {
+            "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+            "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+            "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+            "4k3/8/8/8/1b6/8/8/RN2K2R w KQ - 0 1"  // In check
+        };
+        
+        MoveGenerator generator;
+        bool same_moves = true;
+        bool hash_first = true;
+        bool captures_before_quiets = true;
+        bool quiescence_skips_losing = true;
+        
+        for (const char* fen : fens) {
+            board.set_from_fen(fen);
+            MoveList legal_moves = generator.generate_legal_moves(board);
+            
+            // Use the last legal move as hash move and a quiet move as killer
+            Move hash_move = legal_moves.back();
+            Move killers[2] = {Move(), Move()};
+            for (const Move& move : legal_moves) {
+                if (!move.is_capture() && move != hash_move) {
+                    killers[0] = move;
+                }
+            }
+            
+            MovePicker picker(board, generator, hash_move, killers);
+            MoveList picked;
+            bool seen_quiet = false;
+            Move move;
+            while (!(move = picker.next_move()).is_null()) {
+                same_moves &= legal_moves.contains(move) && !picked.contains(move);
+                if (picked.empty()) hash_first &= (move == hash_move);
+                if (picked.size() > 0 && !board.is_in_check(board.get_active_color())) {
+                    // Only captures that lose material may wait behind the killers
+                    if (!move.is_capture() && !move.is_promotion()) seen_quiet = true;
+                    else if (seen_quiet && generator.see(board, move) >= 0) captures_before_quiets = false;
+                }
+                picked.push_back(move);
+            }
+            same_moves &= picked.size() == legal_moves.size();
+            
+            MovePicker quiescence_picker(board, generator);
+            while (!(move = quiescence_picker.next_move()).is_null()) {
+                if (!board.is_in_check(board.get_active_color()) && generator.see(board, move) < 0) {
+                    quiescence_skips_losing = false;
+                }
+            }
+        }
+        
+        assert_test(same_moves, "Picker returns every legal move exactly once");
+        assert_test(hash_first, "Hash move is returned first");
+        assert_test(captures_before_quiets, "Winning captures are returned before quiet moves");
+        assert_test(quiescence_skips_losing, "Quiescence picker drops captures that lose material");
+        
+        std::cout << "\n";
+    }
+
+    void test_transposition_table() {
+        std::cout << "Testing Transposition Table...\n";
+        
+        TranspositionTable table(1);
+        board.set_starting_position();
+        uint64_t key = board.get_hash_key();
+        Move move = MoveGenerator().generate_legal_moves(board)[0];
+        
+        TranspositionTable::ProbeResult entry;
+        assert_test(!table.probe(key, entry), "Empty table misses");
+        
+        table.store(key, move, -123, 7, TranspositionTable::BOUND_LOWER);
+        bool hit = table.probe(key, entry);
+        assert_test(hit && entry.move == move && entry.score == -123 && entry.depth == 7 &&
+                    entry.bound == TranspositionTable::BOUND_LOWER, "Stored entry round-trips");
+        
+        // A later store without a move keeps the known best move
+        table.store(key, Move(), 50, 8, TranspositionTable::BOUND_UPPER);
+        assert_test(table.probe(key, entry) && entry.move == move && entry.score == 50, "Best move is preserved");
+        assert_test(table.entry_count() == 1024 * 1024 / 16, "Size is a power of two in 16-byte entries");
+        
+        // A shallow bound of a later re-search must not wipe out a deep exact score
+        table.store(key, move, 35, 12, TranspositionTable::BOUND_EXACT);
+        table.store(key, Move(), -400, 1, TranspositionTable::BOUND_UPPER);
+        assert_test(table.probe(key, entry) && entry.depth == 12 && entry.score == 35 &&
+                    entry.bound == TranspositionTable::BOUND_EXACT && entry.move == move,
+                    "Deep exact entry survives a shallow bound");
+        table.store(key, Move(), 20, 11, TranspositionTable::BOUND_LOWER);
+        assert_test(table.probe(key, entry) && entry.depth == 11 && entry.score == 20,
+                    "Bound within the depth margin replaces the entry");
+        table.new_search();
+        table.store(key, Move(), -10, 2, TranspositionTable::BOUND_UPPER);
+        assert_test(table.probe(key, entry) && entry.depth == 2, "Entry of an earlier search is replaced");
+        
+        // Searching fills the table and reports its statistics
+        search.clear_hash();
+        Search::SearchResult result = search.search_with_stats(board, 4);
+        assert_test(result.stats.tt_probes > 0 && result.stats.tt_hits > 0, "Search probes and hits the table");
+        assert_test(result.stats.tt_hashfull > 0 && result.stats.tt_hashfull <= 1000, "Occupancy reported in permill");
+        
+        std::cout << "Hit rate: " << result.stats.tt_hit_rate() * 100 << "%, occupancy: "
+                  << result.stats.tt_hashfull << " permill\n";
+        std::cout << "\n";
+    }
+
+    void test_quiescence() {
+        std::cout << "Testing Quiescence Search...\n";
+        
+        // Qxd5 wins a pawn at depth 1 unless the recapture exd5 is seen
+        board.set_from_fen("4k3/8/4p3/3p4/8/8/8/3QK3 w - - 0 1");
+        search.clear_hash();
+        Search::SearchResult result = search.search_with_stats(board, 1);
+        
+        assert_test(result.best_move.to_algebraic() != "d1d5", "Avoids a defended pawn at depth 1");
+        assert_test(result.stats.qnodes_searched > 0, "Quiescence nodes counted");
+        assert_test(result.stats.qnodes_searched <= result.stats.nodes_searched, "Quiescence nodes are part of the total");
+        
+        // An undefended queen is still taken
+        board.set_from_fen("4k3/8/8/3q4/8/8/8/3QK3 w - - 0 1");
+        result = search.search_with_stats(board, 1);
+        assert_test(result.best_move.to_algebraic() == "d1d5", "Captures a hanging queen");
+        
+        std::cout << "Quiescence nodes: " << result.stats.qnodes_searched << " of "
+                  << result.stats.nodes_searched << "\n";
+        std::cout << "\n";
+    }
+
+    void test_lazy_smp() {
+        std::cout << "Testing Lazy SMP Search...\n";
+        
+        board.set_from_fen("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+        MoveList legal_moves = MoveGenerator().generate_legal_moves(board);
+        
+        Search smp_search;
+        smp_search.set_evaluation(&evaluation);
+        smp_search.set_threads(4);
+        Search::SearchResult result = smp_search.search_with_stats(board, 4);
+        
+        assert_test(smp_search.get_threads() == 4, "Thread count is configurable");
+        assert_test(legal_moves.contains(result.best_move), "Returns a legal move");
+        assert_test(result.depth == 4, "Main thread completes the requested depth");
+        assert_test(board.get_hash_key() == board.compute_hash_key(), "Root board is left untouched");
+        
+        // Shrinking back to one thread works between searches
+        smp_search.set_threads(1);
+        Search::SearchResult single = smp_search.search_with_stats(board, 3);
+        assert_test(smp_search.get_threads() == 1 && legal_moves.contains(single.best_move), "Back to a single thread");
+        
+        // Evaluations built on other threads share the pawn masks of the first
+        Board passer;
+        passer.set_from_fen("4k3/8/8/3P4/8/8/p7/4K3 w - - 0 1");
+        int expected = evaluation.evaluate(passer);
+        int scores[4] = {0, 0, 0, 0};
+        std::vector<std::thread> builders;
+        for (int& score : scores) {
+            builders.emplace_back([&score]() {
+                Board thread_board;
+                thread_board.set_from_fen("4k3/8/8/3P4/8/8/p7/4K3 w - - 0 1");
+                score = Evaluation().evaluate(thread_board);
+            });
+        }
+        for (std::thread& builder : builders) {
+            builder.join();
+        }
+        bool all_agree = true;
+        for (int score : scores) {
+            all_agree &= score == expected;
+        }
+        assert_test(all_agree, "Evaluations created on other threads score alike");
+        
+        std::cout << "4 threads: " << result.best_move.to_algebraic() << ", nodes (all threads): "
+                  << result.stats.nodes_searched << "\n";
+        std::cout << "\n";
+    }
+
+    void test_aspiration_windows() {
+        std::cout << "Testing PVS and Aspiration Windows...\n";
+        
+        // Qd8+ Bxd8 Re8# is found at depth 3; a mate score is never narrowed
+        board.set_from_fen("r1b2k1r/ppp1bppp/8/1B1Q4/5q2/2P5/PPP2PPP/R3R1K1 w - - 1 1");
+        search.clear_hash();
+        Search::SearchResult result = search.search_with_stats(board, 4);
+        
+        assert_test(result.best_move.to_algebraic() == "d5d8", "Finds the queen sacrifice");
+        assert_test(result.is_mate && result.mate_in == 2, "Reports mate in 2");
+        assert_test(result.stats.aspiration_researches == 0, "Mate score is searched with a full window");
+        
+        // The pawn on d7 swings the score by far more than the window between
+        // depths 3 and 4, so the depth 4 window must fail and be widened
+        board.set_from_fen("rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8");
+        search.clear_hash();
+        Search::SearchResult swing = search.search_with_stats(board, 4);
+        
+        assert_test(swing.stats.aspiration_researches > 0, "Score jump triggers an aspiration re-search");
+        assert_test(swing.best_move.to_algebraic() == "d7c8q" && !swing.is_mate,
+                    "Widened window still finds the promotion");
+        
+        std::cout << "Best move: " << swing.best_move.to_algebraic() << ", score: " << swing.score
+                  << ", aspiration re-searches: " << swing.stats.aspiration_researches << "\n";
+        std::cout << "\n";
+    }
+
+    void test_null_move_pruning() {
+        std::cout << "Testing Null-Move Pruning...\n";
+        
+        // Passing clears the en passant file and flips the side to move
+        const std::string fen = "rnbqkbnr/ppp1pppp/8/3pP3/8/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 3";
+        board.set_from_fen(fen);
+        uint64_t key = board.get_hash_key();
+        auto undo_data = board.make_null_move();
+        assert_test(board.get_active_color() == Board::BLACK, "Null move passes the turn");
+        assert_test(board.get_en_passant_file() == -1, "Null move clears en passant");
+        assert_test(board.get_hash_key() == board.compute_hash_key(), "Null move keeps the hash key in sync");
+        board.undo_null_move(undo_data);
+        assert_test(board.to_fen() == fen && board.get_hash_key() == key, "Undo restores the position and key");
+        
+        // Pruning must not hide the mate found in the aspiration test
+        board.set_from_fen("r1b2k1r/ppp1bppp/8/1B1Q4/5q2/2P5/PPP2PPP/R3R1K1 w - - 1 1");
+        search.clear_hash();
+        Search::SearchResult result = search.search_with_stats(board, 6);
+        assert_test(result.is_mate && result.mate_in == 2, "Mate survives null-move pruning");
+        
+        std::cout << "Depth 6 nodes: " << result.stats.nodes_searched << "\n";
+        std::cout << "\n";
+    }
+
+    void test_late_move_reductions() {
+        std::cout << "Testing Late Move Reductions...\n";
+        
+        // Reductions grow with depth and move number
+        assert_test(search.get_reduction(1, 1) == 0, "No reduction for the first move at depth 1");
+        assert_test(search.get_reduction(8, 30) > search.get_reduction(3, 4), "Reductions grow with depth and move number");
+        
+        board.set_from_fen("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3R1K1 b kq - 0 1");
+        search.clear_hash();
+        Search::SearchResult reduced = search.search_with_stats(board, 5);
+        assert_test(reduced.stats.reduced_moves > 0, "Late moves are reduced");
+        assert_test(reduced.stats.reduced_researches <= reduced.stats.reduced_moves, "Re-searches are counted");
+        
+        // Switching both techniques off must cost nodes
+        Search::ReductionParameters defaults = search.get_reduction_parameters();
+        Search::ReductionParameters disabled;
+        disabled.min_depth = 1000;
+        disabled.lmp_max_depth = 0;
+        search.set_reduction_parameters(disabled);
+        search.clear_hash();
+        Search::SearchResult full = search.search_with_stats(board, 5);
+        search.set_reduction_parameters(defaults);
+        assert_test(full.stats.reduced_moves == 0, "Reductions can be disabled");
+        assert_test(reduced.stats.nodes_searched < full.stats.nodes_searched, "Reductions save nodes");
+        
+        // Depth 1 nodes are then eligible but have no depth left to reduce
+        Search::ReductionParameters shallow = defaults;
+        shallow.min_depth = 1;
+        search.set_reduction_parameters(shallow);
+        search.clear_hash();
+        Search::SearchResult shallow_result = search.search_with_stats(board, 4);
+        search.set_reduction_parameters(defaults);
+        assert_test(shallow_result.depth == 4 && MoveGenerator().generate_legal_moves(board).contains(shallow_result.best_move),
+                    "Reducing from depth 1 keeps the search sound");
+        
+        std::cout << "Depth 5 nodes: " << reduced.stats.nodes_searched << " with reductions, "
+                  << full.stats.nodes_searched << " without (" << reduced.stats.reduced_moves
+                  << " reduced, " << reduced.stats.reduced_researches << " re-searched)\n";
+        std::cout << "\n";
+    }
+
+    void test_move_history() {
+        std::cout << "Testing Killer, History and Countermove Heuristics...\n";
+        
+        board.set_from_fen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+        MoveGenerator generator;
+        MoveList legal_moves = generator.generate_legal_moves(board);
+        auto find_move = [&](const std::string& text) {
+            for (const Move& move : legal_moves) {
+                if (move.to_algebraic() == text) return move;
+            }
+            return Move();
+        };
+        Move previous(6, 4, 4, 4, 'p');  // e7e5
+        Move cutoff = find_move("g1f3");
+        Move tried = find_move("a2a3");
+        
+        // A cutoff rewards the move and penalises the quiets tried before it
+        MoveHistory history;
+        history.update_quiet_cutoff(Board::WHITE, cutoff, previous, 2, 4, &tried, 1);
+        assert_test(history.killers(2)[0] == cutoff, "Cutoff move becomes a killer");
+        assert_test(history.countermove(previous) == cutoff, "Cutoff move becomes the countermove");
+        assert_test(history.history_score(Board::WHITE, cutoff) > 0 &&
+                    history.history_score(Board::WHITE, tried) < 0, "History rewards cutoffs and penalises earlier quiets");
+        
+        // Gravity keeps scores bounded however often a move cuts off
+        for (int i = 0; i < 10000; ++i) {
+            history.update_quiet_cutoff(Board::WHITE, cutoff, previous, 2, 10, nullptr, 0);
+        }
+        int saturated = history.history_score(Board::WHITE, cutoff);
+        assert_test(saturated > 0 && saturated <= MoveHistory::HISTORY_MAX, "History scores stay bounded");
+        
+        // Aging keeps the tables but halves the scores and drops the killers
+        history.age();
+        assert_test(history.history_score(Board::WHITE, cutoff) == saturated / 2, "Aging halves history scores");
+        assert_test(history.killers(2)[0].is_null(), "Aging clears killers");
+        assert_test(history.countermove(previous) == cutoff, "Aging keeps countermoves");
+        
+        // Quiet moves come out by history, and the countermove before them
+        Move counter = find_move("b1c3");
+        history.clear();
+        history.update_quiet_cutoff(Board::WHITE, counter, previous, 2, 4, nullptr, 0);
+        history.update_quiet_cutoff(Board::WHITE, cutoff, Move(), 3, 8, nullptr, 0);
+        MovePicker picker(board, generator, Move(), nullptr, counter, &history);
+        Move first = picker.next_move();
+        Move second = picker.next_move();
+        MoveList picked;
+        picked.push_back(first);
+        picked.push_back(second);
+        bool same_moves = true;
+        Move move;
+        while (!(move = picker.next_move()).is_null()) {
+            same_moves &= legal_moves.contains(move) && !picked.contains(move);
+            picked.push_back(move);
+        }
+        assert_test(first == counter, "Countermove is tried before other quiet moves");
+        assert_test(second == cutoff, "Quiet moves are ordered by history");
+        assert_test(same_moves && picked.size() == legal_moves.size(), "Picker still returns every legal move once");
+        
+        // History can be kept from one search of a game to the next
+        search.set_persistent_history(true);
+        Search::SearchResult result = search.search_with_stats(board, 4);
+        search.set_persistent_history(false);
+        assert_test(!result.best_move.is_null(), "Search runs with persistent history");
+        
+        std::cout << "\n";
+    }
+
+    void test_time_manager() {
+        std::cout << "Testing Time Manager...\n";
+        using std::chrono::milliseconds;
+        
+        // Sudden death: a slice of the clock, with room to overrun it
+        TimeManager manager;
+        assert_test(!manager.is_limited() && manager.can_start_iteration(milliseconds(100000)),
+                    "Unlimited search always continues");
+        TimeManager::TimeControl clock;
+        clock.time_left = milliseconds(60000);
+        manager.start(clock);
+        milliseconds available = clock.time_left - manager.get_move_overhead();
+        assert_test(manager.soft_limit() == available / TimeManager::DEFAULT_MOVES_TO_GO,
+                    "Soft limit spreads the clock over the expected moves");
+        assert_test(manager.hard_limit() == manager.soft_limit() * TimeManager::HARD_LIMIT_FACTOR,
+                    "Hard limit allows overrunning the soft limit");
+        
+        // Increment and moves to go, never planning past most of the clock
+        clock.increment = milliseconds(1000);
+        clock.moves_to_go = 1;
+        manager.start(clock);
+        assert_test(manager.soft_limit() <= available * 8 / 10 && manager.hard_limit() <= available * 8 / 10,
+                    "Last move before the control keeps a reserve");
+        clock.time_left = milliseconds(10);
+        manager.start(clock);
+        assert_test(manager.soft_limit() >= milliseconds(1), "Nearly flagged clock still allocates time");
+        
+        // An iteration is skipped if it would not finish
+        manager.start(milliseconds(100));
+        assert_test(manager.can_start_iteration(milliseconds(10)), "Short iteration fits the budget");
+        assert_test(!manager.can_start_iteration(milliseconds(80)), "Long iteration is not started");
+        
+        // The search honours both kinds of limit
+        board.set_from_fen("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+        Search::SearchResult timed = search.search_with_stats_timed(board, 64, milliseconds(200));
+        clock.time_left = milliseconds(3000);
+        clock.increment = milliseconds(0);
+        clock.moves_to_go = 0;
+        Search::SearchResult on_clock = search.search_with_stats_timed(board, 64, clock);
+        manager.start(clock);
+        assert_test(!timed.best_move.is_null() && timed.stats.time_elapsed < milliseconds(300),
+                    "Fixed move time is respected");
+        assert_test(!on_clock.best_move.is_null() && on_clock.stats.time_elapsed <= manager.hard_limit() + milliseconds(100),
+                    "Game clock allocation is respected");
+        
+        std::cout << "Move time 200ms: depth " << timed.depth << " in " << timed.stats.time_elapsed.count()
+                  << "ms; clock 3s: depth " << on_clock.depth << " in " << on_clock.stats.time_elapsed.count()
+                  << "ms (soft " << manager.soft_limit().count() << "ms, hard " << manager.hard_limit().count() << "ms)\n";
+        std::cout << "\n";
+    }
+
+    void test_principal_variation() {
+        std::cout << "Testing Principal Variation...\n";
+        
+        // The mating line is reported move by move
+        board.set_from_fen("r1b2k1r/ppp1bppp/8/1B1Q4/5q2/2P5/PPP2PPP/R3R1K1 w - - 1 1");
+        search.clear_hash();
+        Search::SearchResult mate = search.search_with_stats(board, 4);
+        std::string mate_line;
+        for (const Move& move : mate.pv) {
+            mate_line += move.to_algebraic() + " ";
+        }
+        assert_test(mate_line == "d5d8 e7d8 e1e8 ", "PV is the full mating line");
+        
+        // Every PV move is legal in the position it is played from
+        board.set_from_fen("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+        const std::string fen = board.to_fen();
+        Search::SearchResult result = search.search_with_stats(board, 6);
+        MoveGenerator generator;
+        bool legal_line = !result.pv.empty() && result.pv[0] == result.best_move;
+        std::string line;
+        for (const Move& move : result.pv) {
+            legal_line &= generator.generate_legal_moves(board).contains(move);
+            if (!legal_line) break;
+            board.apply_move(move);
+            line += move.to_algebraic() + " ";
+        }
+        board.set_from_fen(fen);
+        assert_test(legal_line, "PV starts with the best move and is legal");
+        assert_test(result.pv.size() >= 4, "PV reaches deep into the tree");
+        
+        std::cout << "Mate PV: " << mate_line << "\nDepth 6 PV: " << line << "\n";
+        std::cout << "\n";
+    }
+
+    void test_async_search() {
+        std::cout << "Testing Asynchronous Search...\n";
+        using std::chrono::milliseconds;
+        using Clock = std::chrono::steady_clock;
+        
+        // A depth-limited search reports every iteration and finishes on its own
+        board.set_from_fen("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+        int iterations = 0;
+        int last_depth = 0;
+        bool finished = false;
+        search.set_progress_callback([&](const Search::SearchResult& progress) {
+            iterations++;
+            last_depth = progress.depth;
+        });
+        Search::SearchLimits limits;
+        limits.depth = 5;
+        search.start_search(board, limits, [&](const Search::SearchResult&) { finished = true; });
+        Search::SearchResult result = search.wait();
+        search.set_progress_callback(nullptr);
+        assert_test(finished && result.depth == 5 && !search.is_searching(), "Depth-limited search finishes on its own");
+        assert_test(iterations == 5 && last_depth == 5, "Progress is reported after every iteration");
+        
+        // An infinite search runs until stopped, and stops at once
+        limits = Search::SearchLimits();
+        limits.infinite = true;
+        search.start_search(board, limits);
+        std::this_thread::sleep_for(milliseconds(100));
+        bool still_running = search.is_searching();
+        Clock::time_point stop_start = Clock::now();
+        Search::SearchResult stopped = search.stop();
+        auto stop_latency = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - stop_start);
+        MoveGenerator generator;
+        assert_test(still_running && !search.is_searching(), "Infinite search runs until stopped");
+        assert_test(generator.generate_legal_moves(board).contains(stopped.best_move) && stopped.depth > 0,
+                    "Stopped search returns the last completed iteration");
+        assert_test(stop_latency < milliseconds(20), "stop() returns promptly");
+        
+        // A ponder search ignores its clock until ponderhit
+        limits = Search::SearchLimits();
+        limits.move_time = milliseconds(50);
+        limits.ponder = true;
+        search.start_search(board, limits);
+        std::this_thread::sleep_for(milliseconds(150));
+        bool pondering = search.is_searching();
+        search.ponderhit();
+        Clock::time_point ponderhit_time = Clock::now();
+        Search::SearchResult pondered = search.wait();
+        auto after_ponderhit = std::chrono::duration_cast<milliseconds>(Clock::now() - ponderhit_time);
+        assert_test(pondering && !pondered.best_move.is_null(), "Ponder search waits for ponderhit");
+        assert_test(after_ponderhit < milliseconds(150), "Ponderhit starts the move time");
+        
+        // A synchronous search still works after a stopped one
+        Search::SearchResult sync = search.search_with_stats(board, 3);
+        assert_test(sync.depth == 3, "Synchronous search is not affected by an earlier stop()");
+        
+        std::cout << "stop() latency: " << stop_latency.count() << "us at depth " << stopped.depth
+                  << "; finished " << after_ponderhit.count() << "ms after ponderhit\n";
+        std::cout << "\n";
+    }
+
     void test_alpha_beta_pruning() {
         std::cout << "Testing Alpha-Beta Pruning...\n";
         
         board.set_from_fen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
         
         // Search with different depths to verify pruning effectiveness
-        Search::SearchResult result1 = search.find_best_move(board, 2);
-        Search::SearchResult result2 = search.find_best_move(board, 3);
+        Search::SearchResult result1 = search.search_with_stats(board, 2);
+        Search::SearchResult result2 = search.search_with_stats(board, 3);
         
         assert_test(result2.stats.nodes_searched > result1.stats.nodes_searched, 
                    "Deeper search explores more nodes");
@@ -91,7 +588,7 @@ private:
         
         board.set_from_fen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
         
-        Search::SearchResult result = search.find_best_move(board, 4);
+        Search::SearchResult result = search.search_with_stats(board, 4);
         
         assert_test(result.depth <= 4, "Respects maximum depth");
         assert_test(result.depth >= 1, "Reached at least depth 1");
@@ -109,7 +606,7 @@ private:
         // Test a position where mate is possible
         board.set_from_fen("rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3");
         
-        Search::SearchResult result = search.find_best_move(board, 3);
+        Search::SearchResult result = search.search_with_stats(board, 3);
         
         assert_test(!result.best_move.to_algebraic().empty(), "Returns move in complex position");
         assert_test(result.score != 0 || true, "Score computed");
@@ -129,7 +626,7 @@ private:
         board.set_from_fen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
         
         auto start_time = std::chrono::steady_clock::now();
-        Search::SearchResult result = search.find_best_move_timed(board, std::chrono::milliseconds(100));
+        Search::SearchResult result = search.search_with_stats_timed(board, 10, std::chrono::milliseconds(100));
         auto end_time = std::chrono::steady_clock::now();
         
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
@@ -149,7 +646,7 @@ private:
         // Position with captures available
         board.set_from_fen("rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 2");
         
-        Search::SearchResult result = search.find_best_move(board, 3);
+        Search::SearchResult result = search.search_with_stats(board, 3);
         
         assert_test(result.stats.beta_cutoffs >= 0, "Beta cutoffs tracked");
         assert_test(!result.best_move.to_algebraic().empty(), "Valid move returned");
@@ -166,7 +663,7 @@ private:
         // Position approaching 50-move rule
         board.set_from_fen("8/8/8/8/8/8/8/K6k w - - 99 100");
         
-        Search::SearchResult result = search.find_best_move(board, 2);
+        Search::SearchResult result = search.search_with_stats(board, 2);
         
         assert_test(!result.best_move.to_algebraic().empty() || true, "Handles near-draw position");
         
@@ -181,7 +678,7 @@ private:
         
         board.set_from_fen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
         
-        Search::SearchResult result = search.find_best_move(board, 3);
+        Search::SearchResult result = search.search_with_stats(board, 3);
         
         assert_test(result.stats.nodes_searched > 0, "Nodes searched > 0");
         assert_test(result.stats.time_elapsed.count() >= 0, "Time elapsed >= 0");
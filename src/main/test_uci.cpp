@@ -0,0 +1,164 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <chrono>
+#include <thread>
+#include "../uci/Uci.h"
+#include "../board/Board.h"
+
+class UciTester {
+private:
+    int tests_passed = 0;
+    int tests_failed = 0;
+
+    void assert_test(bool condition, const std::string& test_name) {
+        if (condition) {
+            std::cout << "✓ " << test_name << " PASSED\n";
+            tests_passed++;
+        } else {
+            std::cout << "✗ " << test_name << " FAILED\n";
+            tests_failed++;
+        }
+    }
+
+    static bool contains(const std::string& text, const std::string& part) {
+        return text.find(part) != std::string::npos;
+    }
+
+public:
+    void run_all_tests() {
+        std::cout << "=== UCI Protocol Test Suite ===\n\n";
+
+        test_handshake();
+        test_position();
+        test_go_depth();
+        test_stop_during_search();
+        test_clock_and_nodes();
+        test_script();
+
+        std::cout << "\n=== TEST SUMMARY ===\n";
+        std::cout << "Tests Passed: " << tests_passed << "\n";
+        std::cout << "Tests Failed: " << tests_failed << "\n";
+    }
+
+    int failures() const { return tests_failed; }
+
+private:
+    void test_handshake() {
+        std::cout << "Testing uci / isready / setoption...\n";
+
+        std::ostringstream output;
+        Uci uci(output);
+        uci.execute("uci");
+        uci.execute("setoption name Hash value 32");
+        uci.execute("setoption name Threads value 2");
+        uci.execute("setoption name Move Overhead value 50");
+        uci.execute("isready");
+
+        std::string text = output.str();
+        assert_test(contains(text, "id name Yoki") && contains(text, "uciok"), "uci is answered with id and uciok");
+        assert_test(contains(text, "option name Hash") && contains(text, "option name Threads"),
+                    "Hash and Threads options are announced");
+        assert_test(contains(text, "readyok") && !contains(text, "unknown option"), "Options are accepted");
+        assert_test(!uci.execute("quit"), "quit ends the loop");
+        std::cout << "\n";
+    }
+
+    void test_position() {
+        std::cout << "Testing position...\n";
+
+        std::ostringstream output;
+        Uci uci(output);
+        uci.execute("position startpos moves e2e4 e7e5 g1f3");
+        assert_test(uci.get_board().to_fen() == "rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq - 1 2",
+                    "startpos with moves");
+
+        uci.execute("position fen 8/P7/8/8/8/8/8/k6K w - - 0 1 moves a7a8q");
+        assert_test(uci.get_board().to_fen() == "Q7/8/8/8/8/8/8/k6K b - - 0 1", "fen with a promotion");
+
+        uci.execute("position startpos moves e2e5");
+        assert_test(contains(output.str(), "illegal move e2e5"), "Illegal move is reported");
+        std::cout << "\n";
+    }
+
+    void test_go_depth() {
+        std::cout << "Testing go depth...\n";
+
+        std::ostringstream output;
+        Uci uci(output);
+        uci.execute("position fen r1b2k1r/ppp1bppp/8/1B1Q4/5q2/2P5/PPP2PPP/R3R1K1 w - - 1 1");
+        uci.execute("go depth 4");
+        uci.wait_for_search();
+
+        std::string text = output.str();
+        std::cout << text;
+        assert_test(contains(text, "info depth 1 ") && contains(text, " pv "), "Iterations are reported with a PV");
+        assert_test(contains(text, "score mate 2"), "Mate is reported in moves");
+        assert_test(contains(text, "bestmove d5d8 ponder e7d8"), "bestmove with a ponder move");
+        std::cout << "\n";
+    }
+
+    void test_stop_during_search() {
+        std::cout << "Testing stop and isready during search...\n";
+
+        std::ostringstream output;
+        Uci uci(output);
+        uci.execute("position startpos");
+        uci.execute("go infinite");
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        uci.execute("isready");
+        auto start = std::chrono::steady_clock::now();
+        uci.execute("stop");
+        auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        std::string text = output.str();
+        size_t ready = text.find("readyok");
+        size_t bestmove = text.find("bestmove");
+        assert_test(ready != std::string::npos && bestmove != std::string::npos && ready < bestmove,
+                    "isready is answered while searching");
+        assert_test(latency < std::chrono::milliseconds(20), "stop reports the move promptly");
+        std::cout << "\n";
+    }
+
+    void test_clock_and_nodes() {
+        std::cout << "Testing go with clock and node limits...\n";
+
+        std::ostringstream output;
+        Uci uci(output);
+        uci.execute("position startpos moves e2e4");
+        auto start = std::chrono::steady_clock::now();
+        uci.execute("go wtime 100 btime 3000 winc 0 binc 0");
+        uci.wait_for_search();
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        assert_test(contains(output.str(), "bestmove") && elapsed < std::chrono::milliseconds(1000),
+                    "Clock of the side to move is used");
+
+        std::ostringstream node_output;
+        Uci node_uci(node_output);
+        node_uci.execute("position startpos");
+        node_uci.execute("go nodes 5000");
+        node_uci.wait_for_search();
+        std::string text = node_output.str();
+        size_t last_nodes = text.rfind(" nodes ");
+        int nodes = last_nodes == std::string::npos ? 0 : std::stoi(text.substr(last_nodes + 7));
+        assert_test(contains(text, "bestmove") && nodes > 0 && nodes <= 5000, "Node limit ends the search");
+        std::cout << "\n";
+    }
+
+    void test_script() {
+        std::cout << "Testing a scripted session...\n";
+
+        std::istringstream input("uci\nisready\nposition startpos moves e2e4\ngo depth 3\n");
+        std::ostringstream output;
+        Uci uci(output);
+        uci.loop(input);
+        assert_test(contains(output.str(), "bestmove"), "End of input waits for the search");
+        std::cout << "\n";
+    }
+};
+
+int main() {
+    UciTester tester;
+    tester.run_all_tests();
+    return tester.failures() == 0 ? 0 : 1;
+}
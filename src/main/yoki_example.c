@@ -0,0 +1,140 @@
+/*
+ * Example driver for libyoki: loads the shared library at run time with
+ * dlopen(), the way a Node or Python extension would, and exercises the
+ * C interface. Exits with a nonzero status if any call misbehaves.
+ *
+ * Usage: yoki_example [path/to/libyoki.so]
+ */
+
+#include <dlfcn.h>
+#include <stdio.h>
+#include <string.h>
+#include "capi/yoki.h"
+
+#ifndef YOKI_LIBRARY_PATH
+#define YOKI_LIBRARY_PATH "libyoki.so"
+#endif
+
+/* Function table filled from the library's symbols */
+struct yoki_api {
+    int (*abi_version)(void);
+    const char* (*version)(void);
+    yoki_engine* (*create)(void);
+    void (*destroy)(yoki_engine*);
+    int (*set_hash)(yoki_engine*, int);
+    int (*set_position)(yoki_engine*, const char*, const char* const*, int);
+    int (*make_move)(yoki_engine*, const char*);
+    int (*get_fen)(yoki_engine*, char*, size_t);
+    int (*legal_moves)(yoki_engine*, char*, size_t);
+    int (*evaluate)(yoki_engine*, int*);
+    int (*search)(yoki_engine*, const yoki_limits*, yoki_result*);
+};
+
+static int failures = 0;
+
+static void check(int condition, const char* name) {
+    printf("%s %s %s\n", condition ? "✓" : "✗", name, condition ? "PASSED" : "FAILED");
+    if (!condition) {
+        failures++;
+    }
+}
+
+static int load_symbol(void* library, const char* name, void** target) {
+    *target = dlsym(library, name);
+    if (!*target) {
+        fprintf(stderr, "missing symbol %s: %s\n", name, dlerror());
+        return 0;
+    }
+    return 1;
+}
+
+static int load_api(void* library, struct yoki_api* api) {
+    return load_symbol(library, "yoki_abi_version", (void**)&api->abi_version) &&
+           load_symbol(library, "yoki_version", (void**)&api->version) &&
+           load_symbol(library, "yoki_create", (void**)&api->create) &&
+           load_symbol(library, "yoki_destroy", (void**)&api->destroy) &&
+           load_symbol(library, "yoki_set_hash", (void**)&api->set_hash) &&
+           load_symbol(library, "yoki_set_position", (void**)&api->set_position) &&
+           load_symbol(library, "yoki_make_move", (void**)&api->make_move) &&
+           load_symbol(library, "yoki_get_fen", (void**)&api->get_fen) &&
+           load_symbol(library, "yoki_legal_moves", (void**)&api->legal_moves) &&
+           load_symbol(library, "yoki_evaluate", (void**)&api->evaluate) &&
+           load_symbol(library, "yoki_search", (void**)&api->search);
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : YOKI_LIBRARY_PATH;
+    void* library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!library) {
+        fprintf(stderr, "cannot load %s: %s\n", path, dlerror());
+        return 1;
+    }
+
+    struct yoki_api api;
+    if (!load_api(library, &api)) {
+        dlclose(library);
+        return 1;
+    }
+    printf("Loaded %s (ABI %d)\n", api.version(), api.abi_version());
+    check(api.abi_version() == YOKI_ABI_VERSION, "ABI version matches the header");
+
+    yoki_engine* engine = api.create();
+    check(engine != NULL, "Engine handle is created");
+    if (!engine) {
+        dlclose(library);
+        return 1;
+    }
+    check(api.set_hash(engine, 16) == YOKI_OK, "Hash is resized");
+
+    /* Position from moves, legal moves and evaluation */
+    const char* opening[] = {"e2e4", "e7e5", "g1f3"};
+    char moves[YOKI_MOVES_BUFFER_SIZE];
+    char fen[YOKI_FEN_BUFFER_SIZE];
+    int score = 0;
+    check(api.set_position(engine, NULL, opening, 3) == YOKI_OK, "Position is set from moves");
+    check(api.get_fen(engine, fen, sizeof(fen)) == YOKI_OK &&
+              strcmp(fen, "rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq - 1 2") == 0,
+          "FEN follows the moves");
+    int count = api.legal_moves(engine, moves, sizeof(moves));
+    printf("%d legal moves: %s\n", count, moves);
+    check(count == 29 && strstr(moves, "b8c6") != NULL, "Legal moves are listed");
+    check(api.legal_moves(engine, moves, 8) == YOKI_ERROR_BUFFER_TOO_SMALL, "Short buffer is reported");
+    check(api.evaluate(engine, &score) == YOKI_OK, "Position is evaluated");
+    printf("Static evaluation: %d cp\n", score);
+
+    /* Errors leave the position alone */
+    const char* illegal[] = {"e2e4", "e2e4"};
+    check(api.set_position(engine, "8/8/8/8/8/8/8/8 w - - 0 1", NULL, 0) == YOKI_ERROR_INVALID_FEN,
+          "Invalid FEN is rejected");
+    check(api.set_position(engine, NULL, illegal, 2) == YOKI_ERROR_ILLEGAL_MOVE, "Illegal move is rejected");
+    check(api.make_move(engine, "a1a8") == YOKI_ERROR_ILLEGAL_MOVE, "Illegal single move is rejected");
+    check(api.get_fen(engine, fen, sizeof(fen)) == YOKI_OK && strstr(fen, "5N2") != NULL,
+          "Failed calls keep the previous position");
+
+    /* Searches with limits */
+    yoki_limits limits;
+    yoki_result result;
+    memset(&limits, 0, sizeof(limits));
+    limits.depth = 4;
+    check(api.set_position(engine, "r1b2k1r/ppp1bppp/8/1B1Q4/5q2/2P5/PPP2PPP/R3R1K1 w - - 1 1", NULL, 0) == YOKI_OK &&
+              api.search(engine, &limits, &result) == YOKI_OK,
+          "Depth-limited search");
+    printf("bestmove %s ponder %s mate %d depth %d nodes %lld pv %s\n", result.bestmove, result.ponder,
+           result.mate, result.depth, (long long)result.nodes, result.pv);
+    check(strcmp(result.bestmove, "d5d8") == 0 && result.mate == 2, "Search finds the mate");
+
+    memset(&limits, 0, sizeof(limits));
+    limits.movetime_ms = 100;
+    check(api.set_position(engine, NULL, NULL, 0) == YOKI_OK && api.search(engine, &limits, &result) == YOKI_OK &&
+              result.time_ms < 200 && strlen(result.bestmove) >= 4,
+          "Time-limited search");
+    limits.movetime_ms = -1;
+    check(api.search(engine, &limits, &result) == YOKI_ERROR_INVALID_ARGUMENT, "Negative limit is rejected");
+    check(api.search(NULL, NULL, &result) == YOKI_ERROR_INVALID_ARGUMENT, "Null handle is rejected");
+
+    api.destroy(engine);
+    dlclose(library);
+
+    printf("Tests Failed: %d\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,223 @@
+#include "Uci.h"
+#include <algorithm>
+#include <cctype>
+
+Uci::Uci(std::ostream& output) : output(output) {
+    engine.get_search().set_progress_callback([this](const Search::SearchResult& result) {
+        send(format_info(result));
+    });
+}
+
+Uci::~Uci() {
+    stop_search();
+}
+
+void Uci::loop(std::istream& input) {
+    std::string line;
+    while (std::getline(input, line)) {
+        if (!execute(line)) {
+            return;
+        }
+    }
+
+    // End of input: let a finite search report its move before exiting
+    if (search_waits_for_stop) {
+        stop_search();
+    } else {
+        wait_for_search();
+    }
+}
+
+bool Uci::execute(const std::string& line) {
+    std::istringstream tokens(line);
+    std::string command;
+    tokens >> command;
+
+    if (command == "uci") {
+        handle_uci();
+    } else if (command == "isready") {
+        send("readyok");
+    } else if (command == "setoption") {
+        handle_setoption(tokens);
+    } else if (command == "ucinewgame") {
+        stop_search();
+        engine.new_game();
+    } else if (command == "position") {
+        handle_position(tokens);
+    } else if (command == "go") {
+        handle_go(tokens);
+    } else if (command == "stop") {
+        stop_search();
+    } else if (command == "ponderhit") {
+        search_waits_for_stop = false;
+        engine.get_search().ponderhit();
+    } else if (command == "quit") {
+        stop_search();
+        return false;
+    }
+    return true;
+}
+
+void Uci::wait_for_search() {
+    engine.get_search().wait();
+}
+
+void Uci::send(const std::string& line) {
+    std::lock_guard<std::mutex> lock(output_mutex);
+    output << line << std::endl;
+}
+
+void Uci::handle_uci() {
+    send(std::string("id name ") + ENGINE_NAME);
+    send(std::string("id author ") + ENGINE_AUTHOR);
+    send("option name Hash type spin default " + std::to_string(TranspositionTable::DEFAULT_SIZE_MB) +
+         " min 1 max " + std::to_string(MAX_HASH_MB));
+    send("option name Threads type spin default 1 min 1 max " + std::to_string(MAX_THREADS));
+    send("option name Move Overhead type spin default " +
+         std::to_string(TimeManager::DEFAULT_MOVE_OVERHEAD.count()) + " min 0 max " +
+         std::to_string(MAX_MOVE_OVERHEAD_MS));
+    send("option name Ponder type check default false");
+    send("uciok");
+}
+
+void Uci::handle_setoption(std::istringstream& tokens) {
+    // setoption name <id, may contain spaces> [value <x>]
+    std::string token, name, value;
+    tokens >> token;
+    while (tokens >> token && token != "value") {
+        name += (name.empty() ? "" : " ") + token;
+    }
+    while (tokens >> token) {
+        value += (value.empty() ? "" : " ") + token;
+    }
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+
+    // Options may only change between searches
+    stop_search();
+    Search& search = engine.get_search();
+    try {
+        if (name == "hash") {
+            search.set_hash_size(std::clamp(std::stoi(value), 1, MAX_HASH_MB));
+        } else if (name == "threads") {
+            search.set_threads(std::clamp(std::stoi(value), 1, MAX_THREADS));
+        } else if (name == "move overhead") {
+            search.set_move_overhead(std::chrono::milliseconds(std::clamp(std::stoi(value), 0, MAX_MOVE_OVERHEAD_MS)));
+        } else if (name != "ponder") {
+            send("info string unknown option " + name);
+        }
+    } catch (const std::exception&) {
+        send("info string invalid value for option " + name);
+    }
+}
+
+void Uci::handle_position(std::istringstream& tokens) {
+    std::string token, fen;
+    tokens >> token;
+    if (token == "startpos") {
+        fen = Engine::START_FEN;
+        tokens >> token;
+    } else if (token == "fen") {
+        while (tokens >> token && token != "moves") {
+            fen += (fen.empty() ? "" : " ") + token;
+        }
+    } else {
+        return;
+    }
+
+    stop_search();
+    engine.set_position(fen);
+
+    // The moves are played one by one; an illegal one ends the list
+    while (tokens >> token) {
+        if (!engine.make_move(token)) {
+            send("info string illegal move " + token);
+            break;
+        }
+    }
+}
+
+void Uci::handle_go(std::istringstream& tokens) {
+    Search::SearchLimits limits;
+    TimeManager::TimeControl white_clock, black_clock;
+    std::string token;
+
+    try {
+        while (tokens >> token) {
+            int value = 0;
+            if (token == "infinite") {
+                limits.infinite = true;
+                continue;
+            }
+            if (token == "ponder") {
+                limits.ponder = true;
+                continue;
+            }
+            if (!(tokens >> value)) {
+                break;
+            }
+            if (token == "depth") {
+                limits.depth = std::max(1, value);
+            } else if (token == "movetime") {
+                limits.move_time = std::chrono::milliseconds(std::max(1, value));
+            } else if (token == "nodes") {
+                limits.nodes = std::max(1, value);
+            } else if (token == "wtime") {
+                white_clock.time_left = std::chrono::milliseconds(std::max(1, value));
+            } else if (token == "btime") {
+                black_clock.time_left = std::chrono::milliseconds(std::max(1, value));
+            } else if (token == "winc") {
+                white_clock.increment = std::chrono::milliseconds(std::max(0, value));
+            } else if (token == "binc") {
+                black_clock.increment = std::chrono::milliseconds(std::max(0, value));
+            } else if (token == "movestogo") {
+                white_clock.moves_to_go = black_clock.moves_to_go = std::max(0, value);
+            }
+        }
+    } catch (const std::exception&) {
+        send("info string invalid go command");
+        return;
+    }
+    limits.time_control = engine.get_board().get_active_color() == Board::WHITE ? white_clock : black_clock;
+
+    stop_search();
+    search_waits_for_stop = limits.infinite || limits.ponder;
+    engine.get_search().start_search(engine.get_board(), limits, [this](const Search::SearchResult& result) {
+        send(format_bestmove(result));
+    });
+}
+
+void Uci::stop_search() {
+    engine.get_search().stop();
+    search_waits_for_stop = false;
+}
+
+std::string Uci::format_info(const Search::SearchResult& result) {
+    const Search::SearchStats& stats = result.stats;
+    long long time_ms = stats.time_elapsed.count();
+    long long nps = static_cast<long long>(stats.nodes_searched) * 1000 / std::max(1LL, time_ms);
+
+    std::string line = "info depth " + std::to_string(result.depth);
+    line += result.is_mate ? " score mate " + std::to_string(result.mate_in)
+                           : " score cp " + std::to_string(result.score);
+    line += " nodes " + std::to_string(stats.nodes_searched) + " nps " + std::to_string(nps) +
+            " time " + std::to_string(time_ms) + " hashfull " + std::to_string(stats.tt_hashfull);
+    if (!result.pv.empty()) {
+        line += " pv";
+        for (const Move& move : result.pv) {
+            line += " " + move.to_algebraic();
+        }
+    }
+    return line;
+}
+
+std::string Uci::format_bestmove(const Search::SearchResult& result) const {
+    // No legal move: UCI still expects a reply
+    if (result.best_move.is_null()) {
+        return "bestmove 0000";
+    }
+    std::string line = "bestmove " + result.best_move.to_algebraic();
+    if (result.pv.size() > 1) {
+        line += " ponder " + result.pv[1].to_algebraic();
+    }
+    return line;
+}
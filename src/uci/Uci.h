@@ -0,0 +1,145 @@
+#ifndef UCI_H
+#define UCI_H
+
+#include "../board/Board.h"
+#include "../engine/Engine.h"
+#include "../engine/Search.h"
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+/**
+ * @brief Universal Chess Interface front-end
+ *
+ * Reads UCI commands line by line and drives the Engine's search on its own
+ * thread, so the input keeps being read while the engine thinks: "stop",
+ * "ponderhit" and "isready" are answered in the middle of a search. Search
+ * progress is reported as "info" lines and the result as "bestmove" from the
+ * search thread; every line of output is written under one lock.
+ *
+ * Supported commands: uci, isready, setoption (Hash, Threads, Move Overhead,
+ * Ponder), ucinewgame, position (startpos or fen, with moves), go (depth,
+ * movetime, wtime, btime, winc, binc, movestogo, nodes, infinite, ponder),
+ * stop, ponderhit and quit. Unknown commands are ignored, as the protocol
+ * requires.
+ */
+class Uci {
+public:
+    static constexpr const char* ENGINE_NAME = "Yoki";
+    static constexpr const char* ENGINE_AUTHOR = "Yoki developers";
+
+    // Option ranges announced in reply to "uci"
+    static constexpr int MAX_HASH_MB = 1024;
+    static constexpr int MAX_THREADS = 64;
+    static constexpr int MAX_MOVE_OVERHEAD_MS = 5000;
+
+    /**
+     * @brief Construct a front-end writing to the given stream
+     *
+     * @param output Stream the replies are written to (must outlive the object)
+     */
+    explicit Uci(std::ostream& output = std::cout);
+
+    /**
+     * @brief Destructor - stops a running search
+     */
+    ~Uci();
+
+    Uci(const Uci&) = delete;
+    Uci& operator=(const Uci&) = delete;
+
+    /**
+     * @brief Read and execute commands until "quit" or the end of the input
+     *
+     * At the end of the input a finite search is allowed to finish and report
+     * its move; an infinite or ponder search is stopped.
+     *
+     * @param input Stream of newline-separated commands
+     */
+    void loop(std::istream& input = std::cin);
+
+    /**
+     * @brief Execute one command line
+     *
+     * @param line The command, e.g. "go depth 6"
+     * @return false if the command was "quit", true otherwise
+     */
+    bool execute(const std::string& line);
+
+    /**
+     * @brief Block until the running search has reported its best move
+     *
+     * Must not be called while an infinite or ponder search waits for "stop".
+     */
+    void wait_for_search();
+
+    /**
+     * @brief Get the current position (after the moves of the last "position" command)
+     */
+    const Board& get_board() const { return engine.get_board(); }
+
+private:
+    std::ostream& output;
+    std::mutex output_mutex;   ///< Serialises lines written by the input and search threads
+    Engine engine;
+    bool search_waits_for_stop = false;   ///< The last "go" was infinite or ponder
+
+    /**
+     * @brief Write one line of output
+     *
+     * @param line Text without the trailing newline
+     */
+    void send(const std::string& line);
+
+    /**
+     * @brief Reply to "uci" with the engine id and options
+     */
+    void handle_uci();
+
+    /**
+     * @brief Apply "setoption name <id> value <x>" (stops a running search first)
+     *
+     * @param tokens The command after "setoption"
+     */
+    void handle_setoption(std::istringstream& tokens);
+
+    /**
+     * @brief Set up the board from "position startpos|fen <fen> [moves <m1> ...]"
+     *
+     * @param tokens The command after "position"
+     */
+    void handle_position(std::istringstream& tokens);
+
+    /**
+     * @brief Start a search with the limits of a "go" command
+     *
+     * Only the clock of the side to move is used.
+     *
+     * @param tokens The command after "go"
+     */
+    void handle_go(std::istringstream& tokens);
+
+    /**
+     * @brief Stop the running search, if any, and wait for its bestmove line
+     */
+    void stop_search();
+
+    /**
+     * @brief Format an iteration's result as an "info" line
+     *
+     * @param result Progress reported by the search
+     * @return The line, without the trailing newline
+     */
+    static std::string format_info(const Search::SearchResult& result);
+
+    /**
+     * @brief Format the final result as a "bestmove" line
+     *
+     * @param result Final search result
+     * @return The line, with a ponder move when the PV has one
+     */
+    std::string format_bestmove(const Search::SearchResult& result) const;
+};
+
+#endif // UCI_H